@@ -8,15 +8,20 @@
 
 // [CLI11:public_includes:set]
 #include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include <iostream>
 #include <iterator>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 // [CLI11:public_includes:end]
@@ -46,6 +51,72 @@ namespace CLI {
 namespace detail {
 enum class Classifier { NONE, POSITIONAL_MARK, SHORT, LONG, WINDOWS_STYLE, SUBCOMMAND, SUBCOMMAND_TERMINATOR };
 struct AppFriend;
+
+/// Returned by IdSet searches that find nothing
+constexpr std::size_t no_id = static_cast<std::size_t>(-1);
+
+/// A set of small non-negative integers stored one bit each, for checking many requirements a word at a time
+class IdSet {
+    std::vector<std::uint64_t> words_{};
+
+    /// The lowest set bit of a nonzero word
+    static std::size_t lowest_bit(std::uint64_t word) {
+        std::size_t bit{0};
+        while((word & 1U) == 0) {
+            word >>= 1U;
+            ++bit;
+        }
+        return bit;
+    }
+
+    /// The lowest id >= from in the words produced by combine(word index), or no_id
+    template <typename Combine> std::size_t find(std::size_t from, Combine combine) const {
+        for(std::size_t w = from / 64; w < words_.size(); ++w) {
+            std::uint64_t word = combine(w);
+            if(w == from / 64)
+                word &= ~std::uint64_t{0} << (from % 64);
+            if(word != 0)
+                return w * 64 + lowest_bit(word);
+        }
+        return no_id;
+    }
+
+  public:
+    /// Add an id
+    void insert(std::size_t id) {
+        if(id / 64 >= words_.size())
+            words_.resize(id / 64 + 1, 0);
+        words_[id / 64] |= std::uint64_t{1} << (id % 64);
+    }
+
+    /// Check if an id is in the set
+    bool contains(std::size_t id) const {
+        return id / 64 < words_.size() && (words_[id / 64] & (std::uint64_t{1} << (id % 64))) != 0;
+    }
+
+    /// Remove every id, keeping the storage
+    void clear() { std::fill(words_.begin(), words_.end(), 0); }
+
+    /// The lowest id >= from, or no_id
+    std::size_t next(std::size_t from) const {
+        return find(from, [this](std::size_t w) { return words_[w]; });
+    }
+
+    /// The lowest id that is also in other, or no_id
+    std::size_t first_common(const IdSet &other) const {
+        return find(0, [this, &other](std::size_t w) {
+            return w < other.words_.size() ? words_[w] & other.words_[w] : std::uint64_t{0};
+        });
+    }
+
+    /// The lowest id that is not in other, or no_id
+    std::size_t first_missing(const IdSet &other) const {
+        return find(0, [this, &other](std::size_t w) {
+            return w < other.words_.size() ? words_[w] & ~other.words_[w] : words_[w];
+        });
+    }
+};
+
 }  // namespace detail
 
 namespace FailureMessage {
@@ -62,6 +133,432 @@ class App;
 using App_p = std::shared_ptr<App>;
 
 class Option_group;
+
+template <typename Struct, typename... Fields> class Schema;
+
+/// The order in which options received values, stored as runs of values for the same option
+class ParseOrder {
+  public:
+    /// A run of `count` values for `option`, taken from consecutive arguments starting at `position`, or all from
+    /// the argument at `position` if `repeated` (such as -vvv)
+    struct Span {
+        Option *option;
+        std::size_t count;
+        /// Index of the first value's argument in the command line, not counting the program name
+        std::size_t position;
+        /// true if every value of the run came from the same argument
+        bool repeated;
+    };
+
+    /// Iterates over the options once per value, in the same way as a std::vector<Option *>
+    class const_iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Option *;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Option *const *;
+        using reference = Option *const &;
+
+        const_iterator() = default;
+        const_iterator(const Span *span, std::size_t offset) : span_(span), offset_(offset) {}
+
+        reference operator*() const { return span_->option; }
+        pointer operator->() const { return &span_->option; }
+
+        const_iterator &operator++() {
+            if(++offset_ == span_->count) {
+                ++span_;
+                offset_ = 0;
+            }
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const_iterator prev = *this;
+            ++(*this);
+            return prev;
+        }
+
+        /// The index of the current value's argument in the command line
+        std::size_t position() const { return span_->repeated ? span_->position : span_->position + offset_; }
+
+        bool operator==(const const_iterator &other) const { return span_ == other.span_ && offset_ == other.offset_; }
+        bool operator!=(const const_iterator &other) const { return !(*this == other); }
+
+      private:
+        const Span *span_{nullptr};
+        std::size_t offset_{0};
+    };
+    using iterator = const_iterator;
+    using value_type = Option *;
+    using size_type = std::size_t;
+
+    const_iterator begin() const { return const_iterator(spans_.data(), 0); }
+    const_iterator end() const { return const_iterator(spans_.data() + spans_.size(), 0); }
+
+    /// The number of values recorded
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    /// The runs of values, one entry per option change
+    const std::vector<Span> &spans() const { return spans_; }
+
+    /// Expand to one pointer per value, as parse_order() returns
+    std::vector<Option *> to_vector() const;
+    operator std::vector<Option *>() const { return to_vector(); }
+
+    /// Record a value for an option, extending the last run if it continues it
+    void push_back(Option *opt, std::size_t position);
+    void clear() {
+        spans_.clear();
+        size_ = 0;
+    }
+
+    friend bool operator==(const ParseOrder &order, const std::vector<Option *> &options) {
+        return order.size() == options.size() && std::equal(order.begin(), order.end(), options.begin());
+    }
+    friend bool operator==(const std::vector<Option *> &options, const ParseOrder &order) { return order == options; }
+    friend bool operator!=(const ParseOrder &order, const std::vector<Option *> &options) {
+        return !(order == options);
+    }
+    friend bool operator!=(const std::vector<Option *> &options, const ParseOrder &order) {
+        return !(order == options);
+    }
+
+  private:
+    std::vector<Span> spans_{};
+    std::size_t size_{0};
+};
+
+/// Raw pointers to the elements of a vector of owning pointers, iterated in place without allocating
+template <typename T, typename Owner> class PointerView {
+    using base_iterator = typename std::vector<Owner>::const_iterator;
+
+  public:
+    class iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T *;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T *const *;
+        using reference = T *;
+
+        iterator() = default;
+        explicit iterator(base_iterator it) : it_(it) {}
+
+        T *operator*() const { return it_->get(); }
+        iterator &operator++() {
+            ++it_;
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator prev = *this;
+            ++it_;
+            return prev;
+        }
+        bool operator==(const iterator &other) const { return it_ == other.it_; }
+        bool operator!=(const iterator &other) const { return it_ != other.it_; }
+
+      private:
+        base_iterator it_{};
+    };
+
+    explicit PointerView(const std::vector<Owner> &owners) : owners_(&owners) {}
+
+    iterator begin() const { return iterator(owners_->begin()); }
+    iterator end() const { return iterator(owners_->end()); }
+    std::size_t size() const { return owners_->size(); }
+    bool empty() const { return owners_->empty(); }
+    T *operator[](std::size_t index) const { return (*owners_)[index].get(); }
+
+  private:
+    const std::vector<Owner> *owners_;
+};
+
+/// The distinct groups of a list of options in order of first appearance, like App::get_groups without allocating
+class GroupView {
+  public:
+    class iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string *;
+        using reference = const std::string &;
+
+        iterator() = default;
+        iterator(const std::vector<Option_p> *options, std::size_t index) : options_(options), index_(index) {}
+
+        const std::string &operator*() const { return (*options_)[index_]->get_group(); }
+        const std::string *operator->() const { return &(*options_)[index_]->get_group(); }
+        /// Move to the next option whose group has not been seen before
+        iterator &operator++();
+        iterator operator++(int) {
+            iterator prev = *this;
+            ++*this;
+            return prev;
+        }
+        bool operator==(const iterator &other) const { return index_ == other.index_; }
+        bool operator!=(const iterator &other) const { return index_ != other.index_; }
+
+      private:
+        const std::vector<Option_p> *options_{nullptr};
+        std::size_t index_{0};
+    };
+
+    explicit GroupView(const std::vector<Option_p> &options) : options_(&options) {}
+
+    iterator begin() const { return iterator(options_, 0); }
+    iterator end() const { return iterator(options_, options_->size()); }
+    bool empty() const { return options_->empty(); }
+
+  private:
+    const std::vector<Option_p> *options_;
+};
+
+/// A number of allocations and the bytes they requested
+struct AllocationCount {
+    std::size_t count{0};
+    std::size_t bytes{0};
+};
+
+namespace detail {
+
+/// The allocations made by the current thread, counted by the operator new of CLI/CountAllocations.hpp
+inline AllocationCount &thread_allocations() {
+    static thread_local AllocationCount counter;
+    return counter;
+}
+
+/// True if CLI/CountAllocations.hpp is part of the program
+inline bool &allocations_counted() {
+    static bool counted{false};
+    return counted;
+}
+
+}  // namespace detail
+
+/// The allocations made so far by the current thread, always zero unless CLI/CountAllocations.hpp is included once in
+/// the program
+inline AllocationCount allocations() { return detail::thread_allocations(); }
+
+/// The phases of parsing, and help rendering, timed by a ParseProfile
+enum class ParsePhase : char {
+    validate,
+    configure,
+    tokenize,
+    parse_args,
+    parse_arg,
+    config_file,
+    env,
+    callbacks,
+    requirements,
+    extras,
+    user_callback,
+    help
+};
+
+/// The name of a parse phase
+inline const char *to_string(ParsePhase phase) {
+    static const char *const names[] = {"validate",
+                                        "configure",
+                                        "tokenize",
+                                        "parse_args",
+                                        "parse_arg",
+                                        "config_file",
+                                        "env",
+                                        "callbacks",
+                                        "requirements",
+                                        "extras",
+                                        "user_callback",
+                                        "help"};
+    return names[static_cast<int>(phase)];
+}
+
+/// The time spent in one phase of parsing in one App
+struct PhaseRecord {
+    /// The names of the App and its parents, separated by spaces
+    std::string app{};
+    ParsePhase phase{ParsePhase::validate};
+    std::size_t calls{0};
+    /// Wall time including nested phases
+    std::chrono::nanoseconds total{0};
+    /// Wall time excluding nested phases, such as subcommands or user callbacks
+    std::chrono::nanoseconds self{0};
+    /// Allocations excluding nested phases, only counted with CLI/CountAllocations.hpp
+    AllocationCount allocations{};
+};
+
+/// Wall time and call counts for each phase of parsing and each subcommand, see App::profile
+class ParseProfile {
+  public:
+    /// Receives the name ("app phase") and the times of each finished phase
+    using span_t = std::function<void(const std::string &, std::chrono::steady_clock::time_point,
+                                      std::chrono::steady_clock::time_point)>;
+
+    /// The records in order of first use
+    const std::vector<PhaseRecord> &records() const { return records_; }
+
+    /// The record for a phase of an App (named like PhaseRecord::app), nullptr if that phase did not run
+    const PhaseRecord *find(const std::string &app, ParsePhase phase) const;
+
+    /// Time spent in CLI11 itself, including the conversion and validation of option results
+    std::chrono::nanoseconds library_time() const;
+
+    /// Time spent in user callbacks: those of Apps and the functions given to add_option_function,
+    /// add_flag_callback and add_flag_function
+    std::chrono::nanoseconds user_time() const;
+
+    /// Allocations made by CLI11 itself
+    AllocationCount library_allocations() const;
+
+    /// Allocations made in user callbacks
+    AllocationCount user_allocations() const;
+
+    /// A table of the records
+    std::string to_string() const;
+
+    /// Remove all records
+    void clear();
+
+    /// Pass each finished phase to span, for instance CLI::Tracer::recorder() from CLI/Timer.hpp; the time and
+    /// allocations of span are not counted in the records
+    void on_span(span_t span) { span_ = std::move(span); }
+
+    /// Start timing a phase of app on the current thread, phases on other threads are ignored
+    void begin(const App *app, ParsePhase phase);
+
+    /// Stop timing the innermost phase
+    void end();
+
+  private:
+    using clock = std::chrono::steady_clock;
+
+    /// A phase being timed
+    struct Frame {
+        std::size_t record;
+        clock::time_point start;
+        clock::duration nested;
+        AllocationCount start_allocations;
+        AllocationCount nested_allocations;
+    };
+
+    std::vector<PhaseRecord> records_{};
+    /// The App of each record
+    std::vector<const App *> apps_{};
+    std::vector<Frame> stack_{};
+    std::thread::id thread_{};
+    span_t span_{};
+};
+
+namespace detail {
+
+/// Time a phase for the lifetime of the object, only if profiling is enabled
+class ProfileScope {
+  public:
+    ProfileScope(const std::shared_ptr<ParseProfile> &profile, const App *app, ParsePhase phase) {
+        if(profile) {
+            profile_ = profile.get();
+            profile_->begin(app, phase);
+        }
+    }
+    ProfileScope(const ProfileScope &) = delete;
+    ProfileScope &operator=(const ProfileScope &) = delete;
+    ~ProfileScope() {
+        if(profile_ != nullptr) {
+            profile_->end();
+        }
+    }
+
+  private:
+    ParseProfile *profile_{nullptr};
+};
+
+}  // namespace detail
+
+/// A range of command line arguments as C strings, followed by a null pointer like argv
+class ArgvView {
+  public:
+    ArgvView() = default;
+    ArgvView(const char *const *first, std::size_t count) : data_(first), size_(count) {}
+
+    const char *const *begin() const { return data_; }
+    const char *const *end() const { return data_ + size_; }
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const char *operator[](std::size_t index) const { return data_[index]; }
+
+    /// The null terminated array, ready to be passed to execv and friends
+    const char *const *data() const { return data_; }
+
+  private:
+    static const char *const *terminator() {
+        static const char *const empty[1] = {nullptr};
+        return empty;
+    }
+
+    const char *const *data_{terminator()};
+    std::size_t size_{0};
+};
+
+/// Limits on the size of the input to an App, for parsing untrusted arguments; 0 disables a limit
+struct ParseLimits {
+    /// The number of arguments given to parse
+    std::size_t max_tokens{0};
+    /// The total length in bytes of the arguments given to parse
+    std::size_t max_bytes{0};
+    /// The number of values a single option receives
+    std::size_t max_values{0};
+    /// The nesting of subcommands and of [ ] in vector strings such as "[a,[b]]"
+    std::size_t max_depth{0};
+};
+
+/// The values one invocation of a repeated subcommand received, see App::record_invocations
+class InvocationRecord {
+  public:
+    InvocationRecord() = default;
+    explicit InvocationRecord(std::size_t position) : position_(position) {}
+
+    /// Index in the command line of the first argument after the subcommand name, not counting the program name
+    std::size_t position() const { return position_; }
+
+    /// The options that received values, in definition order
+    std::vector<const Option *> options() const;
+
+    /// The number of values an option received, 0 if it did not receive any
+    std::size_t count(const std::string &option_name) const;
+
+    /// The values an option received
+    std::vector<std::string> results(const std::string &option_name) const;
+
+    /// The values an option received, converted to T
+    template <typename T> T as(const std::string &option_name) const {
+        T output;
+        std::vector<std::string> res = results(option_name);
+        if(!detail::lexical_conversion<T, T>(res, output)) {
+            throw ConversionError(option_name, res);
+        }
+        return output;
+    }
+
+    /// Add the values of an option, moving them out of values
+    void add(const Option *opt, std::vector<std::string> &values);
+
+  private:
+    /// The values of one option, the range [begin, end) of values_
+    struct Entry {
+        const Option *option;
+        std::size_t begin;
+        std::size_t end;
+    };
+
+    /// The entry for an option name, or nullptr
+    const Entry *_find(const std::string &option_name) const;
+
+    std::size_t position_{0};
+    std::vector<Entry> entries_{};
+    std::vector<std::string> values_{};
+};
+
 /// Creates a command line program, with very few defaults.
 /** To use, create a new `Program()` instance with `argc`, `argv`, and a help description. The templated
  *  add_option methods make it easy to prepare options. Remember to call `.start` before starting your
@@ -69,6 +566,7 @@ class Option_group;
 class App {
     friend Option;
     friend detail::AppFriend;
+    template <typename Struct, typename... Fields> friend class Schema;
 
   protected:
     // This library follows the Google style guide for member names ending in underscores
@@ -108,6 +606,27 @@ class App {
     /// before help or ini files are processed. INHERITABLE
     bool immediate_callback_{false};
 
+    /// Keep the values of every invocation of this subcommand in invocations_
+    bool record_invocations_{false};
+
+    /// The recorded invocations, see record_invocations
+    std::vector<InvocationRecord> invocations_{};
+
+    /// The position of the current invocation for its record
+    std::size_t invocation_position_{0};
+
+    /// The callbacks of this subcommand may run concurrently with those of other independent subcommands
+    bool independent_{false};
+
+    /// The number of threads running the callbacks of independent subcommands, 1 runs them in order
+    std::size_t callback_threads_{1};
+
+    /// Limits on the size of the input INHERITABLE
+    ParseLimits parse_limits_{};
+
+    /// The profile of parsing, shared with the subcommands in _configure; null unless profiling is enabled
+    std::shared_ptr<ParseProfile> profile_{};
+
     /// This is a function that runs prior to the start of parsing
     std::function<void(std::size_t)> pre_parse_callback_{};
 
@@ -149,6 +668,36 @@ class App {
     /// This is the formatter for help printing. Default provided. INHERITABLE (same pointer)
     std::shared_ptr<FormatterBase> formatter_{new Formatter()};
 
+    /// Reuse rendered help until something that affects it changes INHERITABLE
+    bool cache_help_{false};
+
+    /// Rendered help text and what it was rendered for
+    struct HelpCacheEntry {
+        /// The value of detail::help_generation() when rendered, 0 if empty
+        std::size_t generation{0};
+        std::string prev{};
+        std::string text{};
+    };
+
+    /// The last help rendered in each AppFormatMode
+    mutable std::array<HelpCacheEntry, 3> help_cache_{};
+
+    /// Inverted index of the words in the help of this App and its subcommands
+    struct HelpIndex {
+        /// The value of detail::help_generation() when built, 0 if never built
+        std::size_t generation{0};
+        /// Every visible option and subcommand, in help order
+        std::vector<HelpMatch> entries{};
+        /// Lowercase word -> ascending positions in entries
+        std::map<std::string, std::vector<std::size_t>> words{};
+    };
+
+    /// Built by the first help_search and rebuilt once help changes
+    mutable HelpIndex help_index_{};
+
+    /// Guards help_cache_ and help_index_, since help() is const and may be called from several threads
+    mutable std::mutex help_cache_mutex_{};
+
     /// The error message printing function INHERITABLE
     std::function<std::string(const App *, const Error &e)> failure_message_{FailureMessage::simple};
 
@@ -163,8 +712,26 @@ class App {
     /// This is faster and cleaner than storing just a list of strings and reparsing. This may contain the -- separator.
     missing_t missing_{};
 
-    /// This is a list of pointers to options with the original parse order
-    std::vector<Option *> parse_order_{};
+    /// The options in the original parse order, as runs of values
+    ParseOrder parse_order_{};
+
+    /// The number of arguments given to the top level parse, used to find argument positions
+    std::size_t parse_args_total_{0};
+
+    /// The argv given to the top level parse, nullptr unless parsing from argc and argv
+    const char *const *argv_{nullptr};
+
+    /// The number of entries in argv_
+    std::size_t argc_{0};
+
+    /// The number of arguments passed through by prefix_command
+    std::size_t passthrough_size_{0};
+
+    /// The passed through arguments, when they are not the end of argv_
+    std::vector<std::string> passthrough_values_{};
+
+    /// Pointers to passthrough_values_ followed by nullptr
+    std::vector<const char *> passthrough_argv_{};
 
     /// This is a list of the subcommands collected, in order
     std::vector<App *> parsed_subcommands_{};
@@ -184,6 +751,30 @@ class App {
     /// subcommand not be
     std::set<Option *> need_options_{};
 
+    /// The requirements among the options and subcommands of this App, as sets of members numbered by position:
+    /// options_ first, then subcommands_
+    struct Requirements {
+        /// The value of detail::help_generation() when compiled, which changes with every requirement setter
+        std::size_t generation{0};
+        /// The number of options, the first subcommand member
+        std::size_t options{0};
+        /// The number of subcommands
+        std::size_t subcommands{0};
+        /// The members each option needs, and that each subcommand needs through its own needs
+        std::vector<detail::IdSet> needs{};
+        /// The members each option or subcommand excludes
+        std::vector<detail::IdSet> excludes{};
+        /// Members with a requirement on something outside this App, which is checked one pair at a time
+        std::vector<bool> outside{};
+        /// The required options
+        detail::IdSet required{};
+        /// The members used in the parse being checked
+        detail::IdSet seen{};
+    };
+
+    /// Compiled by _configure and checked by _process_requirements
+    Requirements requirements_{};
+
     ///@}
     /// @name Subcommands
     ///@{
@@ -263,38 +854,7 @@ class App {
     ///@}
 
     /// Special private constructor for subcommand
-    App(std::string app_description, std::string app_name, App *parent)
-        : name_(std::move(app_name)), description_(std::move(app_description)), parent_(parent) {
-        // Inherit if not from a nullptr
-        if(parent_ != nullptr) {
-            if(parent_->help_ptr_ != nullptr)
-                set_help_flag(parent_->help_ptr_->get_name(false, true), parent_->help_ptr_->get_description());
-            if(parent_->help_all_ptr_ != nullptr)
-                set_help_all_flag(parent_->help_all_ptr_->get_name(false, true),
-                                  parent_->help_all_ptr_->get_description());
-
-            /// OptionDefaults
-            option_defaults_ = parent_->option_defaults_;
-
-            // INHERITABLE
-            failure_message_ = parent_->failure_message_;
-            allow_extras_ = parent_->allow_extras_;
-            allow_config_extras_ = parent_->allow_config_extras_;
-            prefix_command_ = parent_->prefix_command_;
-            immediate_callback_ = parent_->immediate_callback_;
-            ignore_case_ = parent_->ignore_case_;
-            ignore_underscore_ = parent_->ignore_underscore_;
-            fallthrough_ = parent_->fallthrough_;
-            validate_positionals_ = parent_->validate_positionals_;
-            configurable_ = parent_->configurable_;
-            allow_windows_style_options_ = parent_->allow_windows_style_options_;
-            group_ = parent_->group_;
-            footer_ = parent_->footer_;
-            formatter_ = parent_->formatter_;
-            config_formatter_ = parent_->config_formatter_;
-            require_subcommand_max_ = parent_->require_subcommand_max_;
-        }
-    }
+    App(std::string app_description, std::string app_name, App *parent);
 
   public:
     /// @name Basic
@@ -318,227 +878,140 @@ class App {
     /// it is not possible to overload on std::function (fixed in c++14
     /// and backported to c++11 on newer compilers). Use capture by reference
     /// to get a pointer to App if needed.
-    App *callback(std::function<void()> app_callback) {
-        if(immediate_callback_) {
-            parse_complete_callback_ = std::move(app_callback);
-        } else {
-            final_callback_ = std::move(app_callback);
-        }
-        return this;
-    }
+    App *callback(std::function<void()> app_callback);
 
     /// Set a callback for execution when all parsing and processing has completed
     /// aliased as callback
-    App *final_callback(std::function<void()> app_callback) {
-        final_callback_ = std::move(app_callback);
-        return this;
-    }
+    App *final_callback(std::function<void()> app_callback);
 
     /// Set a callback to execute when parsing has completed for the app
     ///
-    App *parse_complete_callback(std::function<void()> pc_callback) {
-        parse_complete_callback_ = std::move(pc_callback);
-        return this;
-    }
+    App *parse_complete_callback(std::function<void()> pc_callback);
 
     /// Set a callback to execute prior to parsing.
     ///
-    App *preparse_callback(std::function<void(std::size_t)> pp_callback) {
-        pre_parse_callback_ = std::move(pp_callback);
-        return this;
-    }
+    App *preparse_callback(std::function<void(std::size_t)> pp_callback);
 
     /// Set a name for the app (empty will use parser to set the name)
-    App *name(std::string app_name = "") {
-
-        if(parent_ != nullptr) {
-            auto oname = name_;
-            name_ = app_name;
-            auto &res = _compare_subcommand_names(*this, *_get_fallthrough_parent());
-            if(!res.empty()) {
-                name_ = oname;
-                throw(OptionAlreadyAdded(app_name + " conflicts with existing subcommand names"));
-            }
-        } else {
-            name_ = app_name;
-        }
-        has_automatic_name_ = false;
-        return this;
-    }
+    App *name(std::string app_name = "");
 
     /// Set an alias for the app
-    App *alias(std::string app_name) {
-        if(app_name.empty() || !detail::valid_alias_name_string(app_name)) {
-            throw IncorrectConstruction("Aliases may not be empty or contain newlines or null characters");
-        }
-        if(parent_ != nullptr) {
-            aliases_.push_back(app_name);
-            auto &res = _compare_subcommand_names(*this, *_get_fallthrough_parent());
-            if(!res.empty()) {
-                aliases_.pop_back();
-                throw(OptionAlreadyAdded("alias already matches an existing subcommand: " + app_name));
-            }
-        } else {
-            aliases_.push_back(app_name);
-        }
-
-        return this;
-    }
+    App *alias(std::string app_name);
 
     /// Remove the error when extras are left over on the command line.
-    App *allow_extras(bool allow = true) {
-        allow_extras_ = allow;
-        return this;
-    }
+    App *allow_extras(bool allow = true);
 
     /// Remove the error when extras are left over on the command line.
-    App *required(bool require = true) {
-        required_ = require;
-        return this;
-    }
+    App *required(bool require = true);
 
     /// Disable the subcommand or option group
-    App *disabled(bool disable = true) {
-        disabled_ = disable;
-        return this;
-    }
+    App *disabled(bool disable = true);
 
     /// silence the subcommand from showing up in the processed list
-    App *silent(bool silence = true) {
-        silent_ = silence;
-        return this;
-    }
+    App *silent(bool silence = true);
 
     /// Set the subcommand to be disabled by default, so on clear(), at the start of each parse it is disabled
-    App *disabled_by_default(bool disable = true) {
-        if(disable) {
-            default_startup = startup_mode::disabled;
-        } else {
-            default_startup = (default_startup == startup_mode::enabled) ? startup_mode::enabled : startup_mode::stable;
-        }
-        return this;
-    }
+    App *disabled_by_default(bool disable = true);
 
     /// Set the subcommand to be enabled by default, so on clear(), at the start of each parse it is enabled (not
     /// disabled)
-    App *enabled_by_default(bool enable = true) {
-        if(enable) {
-            default_startup = startup_mode::enabled;
-        } else {
-            default_startup =
-                (default_startup == startup_mode::disabled) ? startup_mode::disabled : startup_mode::stable;
-        }
-        return this;
-    }
+    App *enabled_by_default(bool enable = true);
 
     /// Set the subcommand callback to be executed immediately on subcommand completion
-    App *immediate_callback(bool immediate = true) {
-        immediate_callback_ = immediate;
-        if(immediate_callback_) {
-            if(final_callback_ && !(parse_complete_callback_)) {
-                std::swap(final_callback_, parse_complete_callback_);
-            }
-        } else if(!(final_callback_) && parse_complete_callback_) {
-            std::swap(final_callback_, parse_complete_callback_);
-        }
+    App *immediate_callback(bool immediate = true);
+
+    /// Record the values of every invocation of a subcommand that is repeated on the command line. Each repeat
+    /// moves the values of the previous invocation into a record and resets only the options it used, and the last
+    /// invocation is copied into a record once parsing is complete; see get_invocations.
+    App *record_invocations(bool value = true) {
+        record_invocations_ = value;
         return this;
     }
 
-    /// Set the subcommand to validate positional arguments before assigning
-    App *validate_positionals(bool validate = true) {
-        validate_positionals_ = validate;
+    /// Mark the callbacks of this subcommand as independent of its siblings, so they may run concurrently with other
+    /// independent subcommands when the parent has callback_threads set
+    App *independent(bool value = true) {
+        independent_ = value;
         return this;
     }
 
-    /// ignore extras in config files
-    App *allow_config_extras(bool allow = true) {
-        if(allow) {
-            allow_config_extras_ = config_extras_mode::capture;
-            allow_extras_ = true;
-        } else {
-            allow_config_extras_ = config_extras_mode::error;
+    /// Set the number of threads used to run the callbacks of independent subcommands, 0 uses the hardware
+    /// concurrency. Consecutive independent subcommands run together and the others run in order between them.
+    App *callback_threads(std::size_t threads = 0);
+
+    /// Record the wall time and call count of each phase of parsing, per subcommand, with the time spent in callbacks
+    /// kept apart. The records are reset by each parse and are available from get_profile.
+    App *profile(bool enable = true) {
+        if(!enable) {
+            _set_profile(nullptr);
+        } else if(!profile_) {
+            _set_profile(std::make_shared<ParseProfile>());
         }
         return this;
     }
 
-    /// ignore extras in config files
-    App *allow_config_extras(config_extras_mode mode) {
-        allow_config_extras_ = mode;
+    /// Report each phase of parsing to span as it finishes, like App::profile which this enables. The name given is
+    /// the path of the App and the phase, such as "prog sub parse_args". Pass CLI::Tracer::global().recorder() to
+    /// show parsing in a Chrome trace.
+    App *trace_phases(ParseProfile::span_t span) {
+        profile();
+        profile_->on_span(std::move(span));
         return this;
     }
 
-    /// Do not parse anything after the first unrecognized option and return
-    App *prefix_command(bool allow = true) {
-        prefix_command_ = allow;
+    /// Limit the size of the input, throwing a LimitError as soon as a limit is exceeded. The token and byte limits
+    /// of the main App apply to the whole command line, the others to the options and subcommands of this App.
+    App *parse_limits(const ParseLimits &limits) {
+        parse_limits_ = limits;
         return this;
     }
 
+    /// Set the subcommand to validate positional arguments before assigning
+    App *validate_positionals(bool validate = true);
+
+    /// ignore extras in config files
+    App *allow_config_extras(bool allow = true);
+
+    /// ignore extras in config files
+    App *allow_config_extras(config_extras_mode mode);
+
+    /// Do not parse anything after the first unrecognized option and return
+    App *prefix_command(bool allow = true);
+
     /// Ignore case. Subcommands inherit value.
-    App *ignore_case(bool value = true) {
-        if(value && !ignore_case_) {
-            ignore_case_ = true;
-            auto *p = (parent_ != nullptr) ? _get_fallthrough_parent() : this;
-            auto &match = _compare_subcommand_names(*this, *p);
-            if(!match.empty()) {
-                ignore_case_ = false;  // we are throwing so need to be exception invariant
-                throw OptionAlreadyAdded("ignore case would cause subcommand name conflicts: " + match);
-            }
-        }
-        ignore_case_ = value;
-        return this;
-    }
+    App *ignore_case(bool value = true);
 
     /// Allow windows style options, such as `/opt`. First matching short or long name used. Subcommands inherit
     /// value.
-    App *allow_windows_style_options(bool value = true) {
-        allow_windows_style_options_ = value;
-        return this;
-    }
+    App *allow_windows_style_options(bool value = true);
 
     /// Specify that the positional arguments are only at the end of the sequence
-    App *positionals_at_end(bool value = true) {
-        positionals_at_end_ = value;
-        return this;
-    }
+    App *positionals_at_end(bool value = true);
 
     /// Specify that the subcommand can be triggered by a config file
-    App *configurable(bool value = true) {
-        configurable_ = value;
-        return this;
-    }
+    App *configurable(bool value = true);
 
     /// Ignore underscore. Subcommands inherit value.
-    App *ignore_underscore(bool value = true) {
-        if(value && !ignore_underscore_) {
-            ignore_underscore_ = true;
-            auto *p = (parent_ != nullptr) ? _get_fallthrough_parent() : this;
-            auto &match = _compare_subcommand_names(*this, *p);
-            if(!match.empty()) {
-                ignore_underscore_ = false;
-                throw OptionAlreadyAdded("ignore underscore would cause subcommand name conflicts: " + match);
-            }
-        }
-        ignore_underscore_ = value;
-        return this;
-    }
+    App *ignore_underscore(bool value = true);
 
     /// Set the help formatter
-    App *formatter(std::shared_ptr<FormatterBase> fmt) {
-        formatter_ = fmt;
-        return this;
-    }
+    App *formatter(std::shared_ptr<FormatterBase> fmt);
 
     /// Set the help formatter
-    App *formatter_fn(std::function<std::string(const App *, std::string, AppFormatMode)> fmt) {
-        formatter_ = std::make_shared<FormatterLambda>(fmt);
+    App *formatter_fn(std::function<std::string(const App *, std::string, AppFormatMode)> fmt);
+
+    /// Reuse the rendered help text until an option, description, formatter or other help content changes.
+    /// Off by default, since sets held by pointer and type_name_fn can change the help without notice. Applies to
+    /// the existing subcommands too, since help after parsing a subcommand is rendered by the subcommand.
+    App *cache_help(bool value = true) {
+        cache_help_ = value;
+        for(const App_p &sub : subcommands_)
+            sub->cache_help(value);
         return this;
     }
 
     /// Set the config formatter
-    App *config_formatter(std::shared_ptr<Config> fmt) {
-        config_formatter_ = fmt;
-        return this;
-    }
+    App *config_formatter(std::shared_ptr<Config> fmt);
 
     /// Check to see if this subcommand was parsed, true only if received on command line.
     bool parsed() const { return parsed_ > 0; }
@@ -568,42 +1041,7 @@ class App {
                        callback_t option_callback,
                        std::string option_description = "",
                        bool defaulted = false,
-                       std::function<std::string()> func = {}) {
-        Option myopt{option_name, option_description, option_callback, this};
-
-        if(std::find_if(std::begin(options_), std::end(options_), [&myopt](const Option_p &v) {
-               return *v == myopt;
-           }) == std::end(options_)) {
-            options_.emplace_back();
-            Option_p &option = options_.back();
-            option.reset(new Option(option_name, option_description, option_callback, this));
-
-            // Set the default string capture function
-            option->default_function(func);
-
-            // For compatibility with CLI11 1.7 and before, capture the default string here
-            if(defaulted)
-                option->capture_default_str();
-
-            // Transfer defaults to the new option
-            option_defaults_.copy_to(option.get());
-
-            // Don't bother to capture if we already did
-            if(!defaulted && option->get_always_capture_default())
-                option->capture_default_str();
-
-            return option.get();
-        }
-        // we know something matches now find what it is so we can produce more error information
-        for(auto &opt : options_) {
-            auto &matchname = opt->matching_name(myopt);
-            if(!matchname.empty()) {
-                throw(OptionAlreadyAdded("added option matched existing option name: " + matchname));
-            }
-        }
-        // this line should not be reached the above loop should trigger the throw
-        throw(OptionAlreadyAdded("added option matched existing option name"));  // LCOV_EXCL_LINE
-    }
+                       std::function<std::string()> func = {});
 
     /// Add option for assigning to a variable
     template <typename AssignTo,
@@ -613,23 +1051,9 @@ class App {
                        AssignTo &variable,  ///< The variable to set
                        std::string option_description = "") {
 
-        auto fun = [&variable](const CLI::results_t &res) {  // comment for spacing
-            return detail::lexical_conversion<AssignTo, ConvertTo>(res, variable);
-        };
-
-        Option *opt = add_option(option_name, fun, option_description, false, [&variable]() {
-            return CLI::detail::checked_to_string<AssignTo, ConvertTo>(variable);
-        });
-        opt->type_name(detail::type_name<ConvertTo>());
-        // these must be actual lvalues since (std::max) sometimes is defined in terms of references and references
-        // to structs used in the evaluation can be temporary so that would cause issues.
-        auto Tcount = detail::type_count<AssignTo>::value;
-        auto XCcount = detail::type_count<ConvertTo>::value;
-        opt->type_size(detail::type_count_min<ConvertTo>::value, (std::max)(Tcount, XCcount));
-        opt->expected(detail::expected_count<ConvertTo>::value);
-        opt->run_callback_for_default();
-        return opt;
-    }
+        Option *opt = add_option(option_name, CLI::callback_t{}, option_description, false);
+        return _bind_variable<AssignTo, ConvertTo>(opt, variable);
+    }
 
     /// Add option for assigning to a variable
     template <typename AssignTo, enable_if_t<!std::is_const<AssignTo>::value, detail::enabler> = detail::dummy>
@@ -655,10 +1079,11 @@ class App {
                                 const std::function<void(const ArgType &)> &func,  ///< the callback to execute
                                 std::string option_description = "") {
 
-        auto fun = [func](const CLI::results_t &res) {
+        auto fun = [this, func](const CLI::results_t &res) {
             ArgType variable;
             bool result = detail::lexical_conversion<ArgType, ArgType>(res, variable);
             if(result) {
+                detail::ProfileScope scope(profile_, this, ParsePhase::user_callback);
                 func(variable);
             }
             return result;
@@ -685,104 +1110,143 @@ class App {
     }
 
     /// Set a help flag, replace the existing one if present
-    Option *set_help_flag(std::string flag_name = "", const std::string &help_description = "") {
-        // take flag_description by const reference otherwise add_flag tries to assign to help_description
-        if(help_ptr_ != nullptr) {
-            remove_option(help_ptr_);
-            help_ptr_ = nullptr;
-        }
-
-        // Empty name will simply remove the help flag
-        if(!flag_name.empty()) {
-            help_ptr_ = add_flag(flag_name, help_description);
-            help_ptr_->configurable(false);
-        }
-
-        return help_ptr_;
-    }
+    Option *set_help_flag(std::string flag_name = "", const std::string &help_description = "");
 
     /// Set a help all flag, replaced the existing one if present
-    Option *set_help_all_flag(std::string help_name = "", const std::string &help_description = "") {
-        // take flag_description by const reference otherwise add_flag tries to assign to flag_description
-        if(help_all_ptr_ != nullptr) {
-            remove_option(help_all_ptr_);
-            help_all_ptr_ = nullptr;
-        }
-
-        // Empty name will simply remove the help all flag
-        if(!help_name.empty()) {
-            help_all_ptr_ = add_flag(help_name, help_description);
-            help_all_ptr_->configurable(false);
-        }
-
-        return help_all_ptr_;
-    }
+    Option *set_help_all_flag(std::string help_name = "", const std::string &help_description = "");
 
     /// Set a version flag and version display string, replace the existing one if present
     Option *set_version_flag(std::string flag_name = "",
                              const std::string &versionString = "",
-                             const std::string &version_help = "Display program version information and exit") {
-        // take flag_description by const reference otherwise add_flag tries to assign to version_description
-        if(version_ptr_ != nullptr) {
-            remove_option(version_ptr_);
-            version_ptr_ = nullptr;
-        }
-
-        // Empty name will simply remove the version flag
-        if(!flag_name.empty()) {
-            version_ptr_ = add_flag_callback(
-                flag_name, [versionString]() { throw(CLI::CallForVersion(versionString, 0)); }, version_help);
-            version_ptr_->configurable(false);
-        }
-
-        return version_ptr_;
-    }
+                             const std::string &version_help = "Display program version information and exit");
     /// Generate the version string through a callback function
     Option *set_version_flag(std::string flag_name,
                              std::function<std::string()> vfunc,
-                             const std::string &version_help = "Display program version information and exit") {
-        if(version_ptr_ != nullptr) {
-            remove_option(version_ptr_);
-            version_ptr_ = nullptr;
-        }
-
-        // Empty name will simply remove the version flag
-        if(!flag_name.empty()) {
-            version_ptr_ = add_flag_callback(
-                flag_name, [vfunc]() { throw(CLI::CallForVersion(vfunc(), 0)); }, version_help);
-            version_ptr_->configurable(false);
-        }
-
-        return version_ptr_;
-    }
+                             const std::string &version_help = "Display program version information and exit");
 
   private:
+    /// Add an option, checking its names for conflicts only against the first `checked_options` options
+    Option *_add_option_internal(std::string option_name,
+                                 callback_t option_callback,
+                                 std::string option_description,
+                                 bool defaulted,
+                                 std::function<std::string()> func,
+                                 std::size_t checked_options);
+
     /// Internal function for adding a flag
     Option *_add_flag_internal(std::string flag_name, CLI::callback_t fun, std::string flag_description) {
-        Option *opt;
-        if(detail::has_default_flag_values(flag_name)) {
-            // check for default values and if it has them
-            auto flag_defaults = detail::get_default_flag_values(flag_name);
-            detail::remove_default_flag_values(flag_name);
-            opt = add_option(std::move(flag_name), std::move(fun), std::move(flag_description), false);
-            for(const auto &fname : flag_defaults)
-                opt->fnames_.push_back(fname.first);
-            opt->default_flag_values_ = std::move(flag_defaults);
-        } else {
-            opt = add_option(std::move(flag_name), std::move(fun), std::move(flag_description), false);
-        }
-        // flags cannot have positional values
-        if(opt->get_positional()) {
-            auto pos_name = opt->get_name(true);
-            remove_option(opt);
-            throw IncorrectConstruction::PositionalFlag(pos_name);
-        }
-        opt->multi_option_policy(MultiOptionPolicy::TakeLast);
-        opt->expected(0);
-        opt->required(false);
+        return _add_flag_internal(std::move(flag_name), std::move(fun), std::move(flag_description), options_.size());
+    }
+
+    /// Internal function for adding a flag, checking its names only against the first `checked_options` options
+    Option *_add_flag_internal(std::string flag_name,
+                               CLI::callback_t fun,
+                               std::string flag_description,
+                               std::size_t checked_options);
+
+    /// Bind a variable to an option: the conversion callback, default capture and type information
+    template <typename AssignTo, typename ConvertTo> static Option *_bind_variable(Option *opt, AssignTo &variable) {
+        opt->callback_ = [&variable](const CLI::results_t &res) {  // comment for spacing
+            return detail::lexical_conversion<AssignTo, ConvertTo>(res, variable);
+        };
+        opt->default_function([&variable]() { return CLI::detail::checked_to_string<AssignTo, ConvertTo>(variable); });
+        _set_default_capture<AssignTo, ConvertTo>(opt, variable);
+        // captured here rather than in add_option so the string conversion can be deferred
+        if(opt->get_always_capture_default())
+            opt->capture_default_str();
+        opt->type_name(detail::type_name<ConvertTo>());
+        // these must be actual lvalues since (std::max) sometimes is defined in terms of references and references
+        // to structs used in the evaluation can be temporary so that would cause issues.
+        auto Tcount = detail::type_count<AssignTo>::value;
+        auto XCcount = detail::type_count<ConvertTo>::value;
+        opt->type_size(detail::type_count_min<ConvertTo>::value, (std::max)(Tcount, XCcount));
+        opt->expected(detail::expected_count<ConvertTo>::value);
+        opt->run_callback_for_default();
+        _set_move_callback<AssignTo, ConvertTo>(opt, variable);
+        _set_typed_result_store<AssignTo, ConvertTo>(opt, variable);
         return opt;
     }
 
+    /// Bind an integer to a flag: repeated flags are summed
+    template <typename T,
+              enable_if_t<std::is_constructible<T, std::int64_t>::value && !is_bool<T>::value, detail::enabler> =
+                  detail::dummy>
+    static Option *_bind_flag(Option *opt, T &flag_count) {
+        flag_count = 0;
+        opt->sum_flags_ = true;
+        opt->callback_ = [&flag_count](const CLI::results_t &res) {
+            try {
+                detail::sum_flag_vector(res, flag_count);
+            } catch(const std::invalid_argument &) {
+                return false;
+            }
+            return true;
+        };
+        return opt->multi_option_policy(MultiOptionPolicy::TakeAll);
+    }
+
+    /// Bind any other single value (bool, enum, string, ...) to a flag
+    template <typename T,
+              enable_if_t<!detail::is_mutable_container<T>::value && !std::is_const<T>::value &&
+                              (!std::is_constructible<T, std::int64_t>::value || is_bool<T>::value) &&
+                              !std::is_constructible<std::function<void(int)>, T>::value,
+                          detail::enabler> = detail::dummy>
+    static Option *_bind_flag(Option *opt, T &flag_result) {
+        opt->callback_ = [&flag_result](const CLI::results_t &res) {
+            return CLI::detail::lexical_cast(res[0], flag_result);
+        };
+        return opt->run_callback_for_default();
+    }
+
+    /// Allow string and vector of string variables to take the results by move if the option enables move_results
+    template <typename AssignTo,
+              typename ConvertTo,
+              enable_if_t<detail::is_string_move_target<AssignTo, ConvertTo>::value, detail::enabler> = detail::dummy>
+    static void _set_move_callback(Option *opt, AssignTo &variable) {
+        opt->move_callback_ = [&variable](CLI::results_t &res) {
+            return detail::lexical_move<AssignTo, ConvertTo>(res, variable);
+        };
+    }
+
+    /// Other variables are always converted from the stored results
+    template <typename AssignTo,
+              typename ConvertTo,
+              enable_if_t<!detail::is_string_move_target<AssignTo, ConvertTo>::value, detail::enabler> = detail::dummy>
+    static void _set_move_callback(Option *, AssignTo &) {}
+
+    /// Captured defaults of copyable variables store a copy of the value and convert it to a string when needed
+    template <typename AssignTo,
+              typename ConvertTo,
+              enable_if_t<std::is_copy_constructible<AssignTo>::value, detail::enabler> = detail::dummy>
+    static void _set_default_capture(Option *opt, AssignTo &variable) {
+        opt->default_capture_ = [&variable]() -> std::function<std::string()> {
+            auto value = std::make_shared<AssignTo>(static_cast<const AssignTo &>(variable));
+            return [value]() { return CLI::detail::checked_to_string<AssignTo, ConvertTo>(*value); };
+        };
+    }
+
+    /// Other variables are converted to a string when the default is captured
+    template <typename AssignTo,
+              typename ConvertTo,
+              enable_if_t<!std::is_copy_constructible<AssignTo>::value, detail::enabler> = detail::dummy>
+    static void _set_default_capture(Option *, AssignTo &) {}
+
+    /// Variables converted from their own type keep a copy of the value for Option::as<AssignTo>()
+    template <typename AssignTo,
+              typename ConvertTo,
+              enable_if_t<std::is_same<AssignTo, ConvertTo>::value && detail::is_cacheable<AssignTo>::value,
+                          detail::enabler> = detail::dummy>
+    static void _set_typed_result_store(Option *opt, AssignTo &variable) {
+        opt->typed_result_store_ = [&variable](Option &option) { option._store_typed_result(variable); };
+    }
+
+    /// Other variables are converted again on each call to Option::as
+    template <typename AssignTo,
+              typename ConvertTo,
+              enable_if_t<!std::is_same<AssignTo, ConvertTo>::value || !detail::is_cacheable<AssignTo>::value,
+                          detail::enabler> = detail::dummy>
+    static void _set_typed_result_store(Option *, AssignTo &) {}
+
   public:
     /// Add a flag with no description or variable assignment
     Option *add_flag(std::string flag_name) { return _add_flag_internal(flag_name, CLI::callback_t(), std::string{}); }
@@ -805,17 +1269,7 @@ class App {
     Option *add_flag(std::string flag_name,
                      T &flag_count,  ///< A variable holding the count
                      std::string flag_description = "") {
-        flag_count = 0;
-        CLI::callback_t fun = [&flag_count](const CLI::results_t &res) {
-            try {
-                detail::sum_flag_vector(res, flag_count);
-            } catch(const std::invalid_argument &) {
-                return false;
-            }
-            return true;
-        };
-        return _add_flag_internal(flag_name, std::move(fun), std::move(flag_description))
-            ->multi_option_policy(MultiOptionPolicy::TakeAll);
+        return _bind_flag(_add_flag_internal(flag_name, CLI::callback_t{}, std::move(flag_description)), flag_count);
     }
 
     /// Other type version accepts all other types that are not vectors such as bool, enum, string or other classes
@@ -828,11 +1282,7 @@ class App {
     Option *add_flag(std::string flag_name,
                      T &flag_result,  ///< A variable holding true if passed
                      std::string flag_description = "") {
-
-        CLI::callback_t fun = [&flag_result](const CLI::results_t &res) {
-            return CLI::detail::lexical_cast(res[0], flag_result);
-        };
-        return _add_flag_internal(flag_name, std::move(fun), std::move(flag_description))->run_callback_for_default();
+        return _bind_flag(_add_flag_internal(flag_name, CLI::callback_t{}, std::move(flag_description)), flag_result);
     }
 
     /// Vector version to capture multiple flags.
@@ -858,33 +1308,12 @@ class App {
     /// Add option for callback that is triggered with a true flag and takes no arguments
     Option *add_flag_callback(std::string flag_name,
                               std::function<void(void)> function,  ///< A function to call, void(void)
-                              std::string flag_description = "") {
-
-        CLI::callback_t fun = [function](const CLI::results_t &res) {
-            bool trigger{false};
-            auto result = CLI::detail::lexical_cast(res[0], trigger);
-            if(result && trigger) {
-                function();
-            }
-            return result;
-        };
-        return _add_flag_internal(flag_name, std::move(fun), std::move(flag_description));
-    }
+                              std::string flag_description = "");
 
     /// Add option for callback with an integer value
     Option *add_flag_function(std::string flag_name,
                               std::function<void(std::int64_t)> function,  ///< A function to call, void(int)
-                              std::string flag_description = "") {
-
-        CLI::callback_t fun = [function](const CLI::results_t &res) {
-            std::int64_t flag_count = 0;
-            detail::sum_flag_vector(res, flag_count);
-            function(flag_count);
-            return true;
-        };
-        return _add_flag_internal(flag_name, std::move(fun), std::move(flag_description))
-            ->multi_option_policy(MultiOptionPolicy::TakeAll);
-    }
+                              std::string flag_description = "");
 
 #ifdef CLI11_CPP14
     /// Add option for callback (C++14 or better only)
@@ -899,50 +1328,10 @@ class App {
     Option *set_config(std::string option_name = "",
                        std::string default_filename = "",
                        const std::string &help_message = "Read an ini file",
-                       bool config_required = false) {
-
-        // Remove existing config if present
-        if(config_ptr_ != nullptr) {
-            remove_option(config_ptr_);
-            config_ptr_ = nullptr;  // need to remove the config_ptr completely
-        }
-
-        // Only add config if option passed
-        if(!option_name.empty()) {
-            config_ptr_ = add_option(option_name, help_message);
-            if(config_required) {
-                config_ptr_->required();
-            }
-            if(!default_filename.empty()) {
-                config_ptr_->default_str(std::move(default_filename));
-            }
-            config_ptr_->configurable(false);
-        }
-
-        return config_ptr_;
-    }
+                       bool config_required = false);
 
     /// Removes an option from the App. Takes an option pointer. Returns true if found and removed.
-    bool remove_option(Option *opt) {
-        // Make sure no links exist
-        for(Option_p &op : options_) {
-            op->remove_needs(opt);
-            op->remove_excludes(opt);
-        }
-
-        if(help_ptr_ == opt)
-            help_ptr_ = nullptr;
-        if(help_all_ptr_ == opt)
-            help_all_ptr_ = nullptr;
-
-        auto iterator =
-            std::find_if(std::begin(options_), std::end(options_), [opt](const Option_p &v) { return v.get() == opt; });
-        if(iterator != std::end(options_)) {
-            options_.erase(iterator);
-            return true;
-        }
-        return false;
-    }
+    bool remove_option(Option *opt);
 
     /// creates an option group as part of the given app
     template <typename T = Option_group>
@@ -963,119 +1352,33 @@ class App {
     ///@{
 
     /// Add a subcommand. Inherits INHERITABLE and OptionDefaults, and help flag
-    App *add_subcommand(std::string subcommand_name = "", std::string subcommand_description = "") {
-        if(!subcommand_name.empty() && !detail::valid_name_string(subcommand_name)) {
-            if(!detail::valid_first_char(subcommand_name[0])) {
-                throw IncorrectConstruction(
-                    "Subcommand name starts with invalid character, '!' and '-' are not allowed");
-            }
-            for(auto c : subcommand_name) {
-                if(!detail::valid_later_char(c)) {
-                    throw IncorrectConstruction(std::string("Subcommand name contains invalid character ('") + c +
-                                                "'), all characters are allowed except"
-                                                "'=',':','{','}', and ' '");
-                }
-            }
-        }
-        CLI::App_p subcom = std::shared_ptr<App>(new App(std::move(subcommand_description), subcommand_name, this));
-        return add_subcommand(std::move(subcom));
-    }
+    App *add_subcommand(std::string subcommand_name = "", std::string subcommand_description = "");
 
     /// Add a previously created app as a subcommand
-    App *add_subcommand(CLI::App_p subcom) {
-        if(!subcom)
-            throw IncorrectConstruction("passed App is not valid");
-        auto ckapp = (name_.empty() && parent_ != nullptr) ? _get_fallthrough_parent() : this;
-        auto &mstrg = _compare_subcommand_names(*subcom, *ckapp);
-        if(!mstrg.empty()) {
-            throw(OptionAlreadyAdded("subcommand name or alias matches existing subcommand: " + mstrg));
-        }
-        subcom->parent_ = this;
-        subcommands_.push_back(std::move(subcom));
-        return subcommands_.back().get();
-    }
+    App *add_subcommand(CLI::App_p subcom);
 
     /// Removes a subcommand from the App. Takes a subcommand pointer. Returns true if found and removed.
-    bool remove_subcommand(App *subcom) {
-        // Make sure no links exist
-        for(App_p &sub : subcommands_) {
-            sub->remove_excludes(subcom);
-            sub->remove_needs(subcom);
-        }
-
-        auto iterator = std::find_if(
-            std::begin(subcommands_), std::end(subcommands_), [subcom](const App_p &v) { return v.get() == subcom; });
-        if(iterator != std::end(subcommands_)) {
-            subcommands_.erase(iterator);
-            return true;
-        }
-        return false;
-    }
+    bool remove_subcommand(App *subcom);
     /// Check to see if a subcommand is part of this command (doesn't have to be in command line)
     /// returns the first subcommand if passed a nullptr
-    App *get_subcommand(const App *subcom) const {
-        if(subcom == nullptr)
-            throw OptionNotFound("nullptr passed");
-        for(const App_p &subcomptr : subcommands_)
-            if(subcomptr.get() == subcom)
-                return subcomptr.get();
-        throw OptionNotFound(subcom->get_name());
-    }
+    App *get_subcommand(const App *subcom) const;
 
     /// Check to see if a subcommand is part of this command (text version)
-    App *get_subcommand(std::string subcom) const {
-        auto subc = _find_subcommand(subcom, false, false);
-        if(subc == nullptr)
-            throw OptionNotFound(subcom);
-        return subc;
-    }
+    App *get_subcommand(std::string subcom) const;
     /// Get a pointer to subcommand by index
-    App *get_subcommand(int index = 0) const {
-        if(index >= 0) {
-            auto uindex = static_cast<unsigned>(index);
-            if(uindex < subcommands_.size())
-                return subcommands_[uindex].get();
-        }
-        throw OptionNotFound(std::to_string(index));
-    }
+    App *get_subcommand(int index = 0) const;
 
     /// Check to see if a subcommand is part of this command and get a shared_ptr to it
-    CLI::App_p get_subcommand_ptr(App *subcom) const {
-        if(subcom == nullptr)
-            throw OptionNotFound("nullptr passed");
-        for(const App_p &subcomptr : subcommands_)
-            if(subcomptr.get() == subcom)
-                return subcomptr;
-        throw OptionNotFound(subcom->get_name());
-    }
+    CLI::App_p get_subcommand_ptr(App *subcom) const;
 
     /// Check to see if a subcommand is part of this command (text version)
-    CLI::App_p get_subcommand_ptr(std::string subcom) const {
-        for(const App_p &subcomptr : subcommands_)
-            if(subcomptr->check_name(subcom))
-                return subcomptr;
-        throw OptionNotFound(subcom);
-    }
+    CLI::App_p get_subcommand_ptr(std::string subcom) const;
 
     /// Get an owning pointer to subcommand by index
-    CLI::App_p get_subcommand_ptr(int index = 0) const {
-        if(index >= 0) {
-            auto uindex = static_cast<unsigned>(index);
-            if(uindex < subcommands_.size())
-                return subcommands_[uindex];
-        }
-        throw OptionNotFound(std::to_string(index));
-    }
+    CLI::App_p get_subcommand_ptr(int index = 0) const;
 
     /// Check to see if an option group is part of this App
-    App *get_option_group(std::string group_name) const {
-        for(const App_p &app : subcommands_) {
-            if(app->name_.empty() && app->group_ == group_name) {
-                return app.get();
-            }
-        }
-        throw OptionNotFound(group_name);
-    }
+    App *get_option_group(std::string group_name) const;
 
     /// No argument version of count counts the number of times this subcommand was
     /// passed in. The main app will return 1. Unnamed subcommands will also return 1 unless
@@ -1084,90 +1387,38 @@ class App {
 
     /// Get a count of all the arguments processed in options and subcommands, this excludes arguments which were
     /// treated as extras.
-    std::size_t count_all() const {
-        std::size_t cnt{0};
-        for(auto &opt : options_) {
-            cnt += opt->count();
-        }
-        for(auto &sub : subcommands_) {
-            cnt += sub->count_all();
-        }
-        if(!get_name().empty()) {  // for named subcommands add the number of times the subcommand was called
-            cnt += parsed_;
-        }
-        return cnt;
-    }
+    std::size_t count_all() const;
 
     /// Changes the group membership
-    App *group(std::string group_name) {
-        group_ = group_name;
-        return this;
-    }
+    App *group(std::string group_name);
 
     /// The argumentless form of require subcommand requires 1 or more subcommands
-    App *require_subcommand() {
-        require_subcommand_min_ = 1;
-        require_subcommand_max_ = 0;
-        return this;
-    }
+    App *require_subcommand();
 
     /// Require a subcommand to be given (does not affect help call)
     /// The number required can be given. Negative values indicate maximum
     /// number allowed (0 for any number). Max number inheritable.
-    App *require_subcommand(int value) {
-        if(value < 0) {
-            require_subcommand_min_ = 0;
-            require_subcommand_max_ = static_cast<std::size_t>(-value);
-        } else {
-            require_subcommand_min_ = static_cast<std::size_t>(value);
-            require_subcommand_max_ = static_cast<std::size_t>(value);
-        }
-        return this;
-    }
+    App *require_subcommand(int value);
 
     /// Explicitly control the number of subcommands required. Setting 0
     /// for the max means unlimited number allowed. Max number inheritable.
-    App *require_subcommand(std::size_t min, std::size_t max) {
-        require_subcommand_min_ = min;
-        require_subcommand_max_ = max;
-        return this;
-    }
+    App *require_subcommand(std::size_t min, std::size_t max);
 
     /// The argumentless form of require option requires 1 or more options be used
-    App *require_option() {
-        require_option_min_ = 1;
-        require_option_max_ = 0;
-        return this;
-    }
+    App *require_option();
 
     /// Require an option to be given (does not affect help call)
     /// The number required can be given. Negative values indicate maximum
     /// number allowed (0 for any number).
-    App *require_option(int value) {
-        if(value < 0) {
-            require_option_min_ = 0;
-            require_option_max_ = static_cast<std::size_t>(-value);
-        } else {
-            require_option_min_ = static_cast<std::size_t>(value);
-            require_option_max_ = static_cast<std::size_t>(value);
-        }
-        return this;
-    }
+    App *require_option(int value);
 
     /// Explicitly control the number of options required. Setting 0
     /// for the max means unlimited number allowed. Max number inheritable.
-    App *require_option(std::size_t min, std::size_t max) {
-        require_option_min_ = min;
-        require_option_max_ = max;
-        return this;
-    }
+    App *require_option(std::size_t min, std::size_t max);
 
     /// Stop subcommand fallthrough, so that parent commands cannot collect commands after subcommand.
     /// Default from parent, usually set on parent.
-    App *fallthrough(bool value = true) {
-        fallthrough_ = value;
-        return this;
-    }
+    App *fallthrough(bool value = true);
 
     /// Check to see if this subcommand was parsed, true only if received on command line.
     /// This allows the subcommand to be directly checked.
@@ -1187,153 +1438,33 @@ class App {
     ///@{
     //
     /// Reset the parsed data
-    void clear() {
-
-        parsed_ = 0;
-        pre_parse_called_ = false;
-
-        missing_.clear();
-        parsed_subcommands_.clear();
-        for(const Option_p &opt : options_) {
-            opt->clear();
-        }
-        for(const App_p &subc : subcommands_) {
-            subc->clear();
-        }
-    }
+    void clear();
 
     /// Parses the command line - throws errors.
     /// This must be called after the options are in but before the rest of the program.
-    void parse(int argc, const char *const *argv) {
-        // If the name is not set, read from command line
-        if(name_.empty() || has_automatic_name_) {
-            has_automatic_name_ = true;
-            name_ = argv[0];
-        }
-
-        std::vector<std::string> args;
-        args.reserve(static_cast<std::size_t>(argc) - 1);
-        for(int i = argc - 1; i > 0; i--)
-            args.emplace_back(argv[i]);
-        parse(std::move(args));
-    }
+    void parse(int argc, const char *const *argv);
 
     /// Parse a single string as if it contained command line arguments.
     /// This function splits the string into arguments then calls parse(std::vector<std::string> &)
     /// the function takes an optional boolean argument specifying if the programName is included in the string to
     /// process
-    void parse(std::string commandline, bool program_name_included = false) {
-
-        if(program_name_included) {
-            auto nstr = detail::split_program_name(commandline);
-            if((name_.empty()) || (has_automatic_name_)) {
-                has_automatic_name_ = true;
-                name_ = nstr.first;
-            }
-            commandline = std::move(nstr.second);
-        } else {
-            detail::trim(commandline);
-        }
-        // the next section of code is to deal with quoted arguments after an '=' or ':' for windows like operations
-        if(!commandline.empty()) {
-            commandline = detail::find_and_modify(commandline, "=", detail::escape_detect);
-            if(allow_windows_style_options_)
-                commandline = detail::find_and_modify(commandline, ":", detail::escape_detect);
-        }
-
-        auto args = detail::split_up(std::move(commandline));
-        // remove all empty strings
-        args.erase(std::remove(args.begin(), args.end(), std::string{}), args.end());
-        std::reverse(args.begin(), args.end());
-
-        parse(std::move(args));
-    }
+    void parse(std::string commandline, bool program_name_included = false);
 
     /// The real work is done here. Expects a reversed vector.
     /// Changes the vector to the remaining options.
-    void parse(std::vector<std::string> &args) {
-        // Clear if parsed
-        if(parsed_ > 0)
-            clear();
-
-        // parsed_ is incremented in commands/subcommands,
-        // but placed here to make sure this is cleared when
-        // running parse after an error is thrown, even by _validate or _configure.
-        parsed_ = 1;
-        _validate();
-        _configure();
-        // set the parent as nullptr as this object should be the top now
-        parent_ = nullptr;
-        parsed_ = 0;
-
-        _parse(args);
-        run_callback();
-    }
+    void parse(std::vector<std::string> &args);
 
     /// The real work is done here. Expects a reversed vector.
-    void parse(std::vector<std::string> &&args) {
-        // Clear if parsed
-        if(parsed_ > 0)
-            clear();
-
-        // parsed_ is incremented in commands/subcommands,
-        // but placed here to make sure this is cleared when
-        // running parse after an error is thrown, even by _validate or _configure.
-        parsed_ = 1;
-        _validate();
-        _configure();
-        // set the parent as nullptr as this object should be the top now
-        parent_ = nullptr;
-        parsed_ = 0;
-
-        _parse(std::move(args));
-        run_callback();
-    }
-
-    void parse_from_stream(std::istream &input) {
-        if(parsed_ == 0) {
-            _validate();
-            _configure();
-            // set the parent as nullptr as this object should be the top now
-        }
+    void parse(std::vector<std::string> &&args);
 
-        _parse_stream(input);
-        run_callback();
-    }
+    void parse_from_stream(std::istream &input);
     /// Provide a function to print a help message. The function gets access to the App pointer and error.
     void failure_message(std::function<std::string(const App *, const Error &e)> function) {
         failure_message_ = function;
     }
 
     /// Print a nice error message and return the exit code
-    int exit(const Error &e, std::ostream &out = std::cout, std::ostream &err = std::cerr) const {
-
-        /// Avoid printing anything if this is a CLI::RuntimeError
-        if(e.get_name() == "RuntimeError")
-            return e.get_exit_code();
-
-        if(e.get_name() == "CallForHelp") {
-            out << help();
-            return e.get_exit_code();
-        }
-
-        if(e.get_name() == "CallForAllHelp") {
-            out << help("", AppFormatMode::All);
-            return e.get_exit_code();
-        }
-
-        if(e.get_name() == "CallForVersion") {
-            out << e.what() << std::endl;
-            return e.get_exit_code();
-        }
-
-        if(e.get_exit_code() != static_cast<int>(ExitCodes::Success)) {
-            if(failure_message_)
-                err << failure_message_(this, e) << std::flush;
-        }
-
-        return e.get_exit_code();
-    }
+    int exit(const Error &e, std::ostream &out = std::cout, std::ostream &err = std::cerr) const;
 
     ///@}
     /// @name Post parsing
@@ -1348,187 +1479,92 @@ class App {
 
     /// Get a filtered subcommand pointer list from the original definition list. An empty function will provide all
     /// subcommands (const)
-    std::vector<const App *> get_subcommands(const std::function<bool(const App *)> &filter) const {
-        std::vector<const App *> subcomms(subcommands_.size());
-        std::transform(std::begin(subcommands_), std::end(subcommands_), std::begin(subcomms), [](const App_p &v) {
-            return v.get();
-        });
-
-        if(filter) {
-            subcomms.erase(std::remove_if(std::begin(subcomms),
-                                          std::end(subcomms),
-                                          [&filter](const App *app) { return !filter(app); }),
-                           std::end(subcomms));
-        }
-
-        return subcomms;
-    }
+    std::vector<const App *> get_subcommands(const std::function<bool(const App *)> &filter) const;
 
     /// Get a filtered subcommand pointer list from the original definition list. An empty function will provide all
     /// subcommands
-    std::vector<App *> get_subcommands(const std::function<bool(App *)> &filter) {
-        std::vector<App *> subcomms(subcommands_.size());
-        std::transform(std::begin(subcommands_), std::end(subcommands_), std::begin(subcomms), [](const App_p &v) {
-            return v.get();
-        });
+    std::vector<App *> get_subcommands(const std::function<bool(App *)> &filter);
+
+    /// The subcommands (including option groups) in definition order, as a view that does not allocate
+    PointerView<const App, App_p> subcommands_view() const { return PointerView<const App, App_p>(subcommands_); }
 
-        if(filter) {
-            subcomms.erase(
-                std::remove_if(std::begin(subcomms), std::end(subcomms), [&filter](App *app) { return !filter(app); }),
-                std::end(subcomms));
+    /// Non-const version of the above
+    PointerView<App, App_p> subcommands_view() { return PointerView<App, App_p>(subcommands_); }
+
+    /// Call visitor with each subcommand (including option groups) in definition order, without allocating
+    template <typename Visitor> void for_each_subcommand(Visitor &&visitor) const {
+        for(const App_p &sub : subcommands_) {
+            visitor(static_cast<const App *>(sub.get()));
         }
+    }
 
-        return subcomms;
+    /// Non-const version of the above
+    template <typename Visitor> void for_each_subcommand(Visitor &&visitor) {
+        for(const App_p &sub : subcommands_) {
+            visitor(sub.get());
+        }
     }
 
     /// Check to see if given subcommand was selected
-    bool got_subcommand(const App *subcom) const {
-        // get subcom needed to verify that this was a real subcommand
-        return get_subcommand(subcom)->parsed_ > 0;
-    }
+    bool got_subcommand(const App *subcom) const;
 
     /// Check with name instead of pointer to see if subcommand was selected
     bool got_subcommand(std::string subcommand_name) const { return get_subcommand(subcommand_name)->parsed_ > 0; }
 
     /// Sets excluded options for the subcommand
-    App *excludes(Option *opt) {
-        if(opt == nullptr) {
-            throw OptionNotFound("nullptr passed");
-        }
-        exclude_options_.insert(opt);
-        return this;
-    }
+    App *excludes(Option *opt);
 
     /// Sets excluded subcommands for the subcommand
-    App *excludes(App *app) {
-        if(app == nullptr) {
-            throw OptionNotFound("nullptr passed");
-        }
-        if(app == this) {
-            throw OptionNotFound("cannot self reference in needs");
-        }
-        auto res = exclude_subcommands_.insert(app);
-        // subcommand exclusion should be symmetric
-        if(res.second) {
-            app->exclude_subcommands_.insert(this);
-        }
-        return this;
-    }
+    App *excludes(App *app);
 
-    App *needs(Option *opt) {
-        if(opt == nullptr) {
-            throw OptionNotFound("nullptr passed");
-        }
-        need_options_.insert(opt);
-        return this;
-    }
+    App *needs(Option *opt);
 
-    App *needs(App *app) {
-        if(app == nullptr) {
-            throw OptionNotFound("nullptr passed");
-        }
-        if(app == this) {
-            throw OptionNotFound("cannot self reference in needs");
-        }
-        need_subcommands_.insert(app);
-        return this;
-    }
+    App *needs(App *app);
 
     /// Removes an option from the excludes list of this subcommand
-    bool remove_excludes(Option *opt) {
-        auto iterator = std::find(std::begin(exclude_options_), std::end(exclude_options_), opt);
-        if(iterator == std::end(exclude_options_)) {
-            return false;
-        }
-        exclude_options_.erase(iterator);
-        return true;
-    }
+    bool remove_excludes(Option *opt);
 
     /// Removes a subcommand from the excludes list of this subcommand
-    bool remove_excludes(App *app) {
-        auto iterator = std::find(std::begin(exclude_subcommands_), std::end(exclude_subcommands_), app);
-        if(iterator == std::end(exclude_subcommands_)) {
-            return false;
-        }
-        auto other_app = *iterator;
-        exclude_subcommands_.erase(iterator);
-        other_app->remove_excludes(this);
-        return true;
-    }
+    bool remove_excludes(App *app);
 
     /// Removes an option from the needs list of this subcommand
-    bool remove_needs(Option *opt) {
-        auto iterator = std::find(std::begin(need_options_), std::end(need_options_), opt);
-        if(iterator == std::end(need_options_)) {
-            return false;
-        }
-        need_options_.erase(iterator);
-        return true;
-    }
+    bool remove_needs(Option *opt);
 
     /// Removes a subcommand from the needs list of this subcommand
-    bool remove_needs(App *app) {
-        auto iterator = std::find(std::begin(need_subcommands_), std::end(need_subcommands_), app);
-        if(iterator == std::end(need_subcommands_)) {
-            return false;
-        }
-        need_subcommands_.erase(iterator);
-        return true;
-    }
+    bool remove_needs(App *app);
 
     ///@}
     /// @name Help
     ///@{
 
     /// Set footer.
-    App *footer(std::string footer_string) {
-        footer_ = std::move(footer_string);
-        return this;
-    }
+    App *footer(std::string footer_string);
     /// Set footer.
-    App *footer(std::function<std::string()> footer_function) {
-        footer_callback_ = std::move(footer_function);
-        return this;
-    }
+    App *footer(std::function<std::string()> footer_function);
     /// Produce a string that could be read in as a config of the current values of the App. Set default_also to
     /// include default arguments. write_descriptions will print a description for the App and for each option.
     std::string config_to_str(bool default_also = false, bool write_description = false) const {
         return config_formatter_->to_config(this, default_also, write_description, "");
     }
 
+    /// Describe the structure of the App and all its subcommands as compact JSON for tools such as completion
+    /// scripts. The output only depends on the definition of the App, so identical Apps give identical bytes.
+    std::string export_json() const;
+
     /// Makes a help message, using the currently configured formatter
     /// Will only do one subcommand at a time
-    std::string help(std::string prev = "", AppFormatMode mode = AppFormatMode::Normal) const {
-        if(prev.empty())
-            prev = get_name();
-        else
-            prev += " " + get_name();
-
-        // Delegate to subcommand if needed
-        auto selected_subcommands = get_subcommands();
-        if(!selected_subcommands.empty()) {
-            return selected_subcommands.at(0)->help(prev, mode);
-        }
-        return formatter_->make_help(this, prev, mode);
-    }
+    std::string help(std::string prev = "", AppFormatMode mode = AppFormatMode::Normal) const;
+
+    /// Writes the help message to a stream, which formatters such as StreamFormatter can do without building it
+    /// as a string first
+    void help(std::ostream &out, std::string prev = "", AppFormatMode mode = AppFormatMode::Normal) const;
+
+    /// Makes help for only the options and subcommands, here or in any subcommand below, with a name, description
+    /// or group containing a word that starts with each word of term. Searches the selected subcommand, like help.
+    std::string help_search(const std::string &term, std::string prev = "") const;
 
     /// Displays a version string
-    std::string version() const {
-        std::string val;
-        if(version_ptr_ != nullptr) {
-            auto rv = version_ptr_->results();
-            version_ptr_->clear();
-            version_ptr_->add_result("true");
-            try {
-                version_ptr_->run_callback();
-            } catch(const CLI::CallForVersion &cfv) {
-                val = cfv.what();
-            }
-            version_ptr_->clear();
-            version_ptr_->add_result(rv);
-        }
-        return val;
-    }
+    std::string version() const;
     ///@}
     /// @name Getters
     ///@{
@@ -1540,112 +1576,51 @@ class App {
     std::shared_ptr<Config> get_config_formatter() const { return config_formatter_; }
 
     /// Access the config formatter as a configBase pointer
-    std::shared_ptr<ConfigBase> get_config_formatter_base() const {
-        // This is safer as a dynamic_cast if we have RTTI, as Config -> ConfigBase
-#if defined(__cpp_rtti) || (defined(__GXX_RTTI) && __GXX_RTTI) || (defined(_HAS_STATIC_RTTI) && (_HAS_STATIC_RTTI == 0))
-        return std::dynamic_pointer_cast<ConfigBase>(config_formatter_);
-#else
-        return std::static_pointer_cast<ConfigBase>(config_formatter_);
-#endif
-    }
+    std::shared_ptr<ConfigBase> get_config_formatter_base() const;
 
     /// Get the app or subcommand description
     std::string get_description() const { return description_; }
 
     /// Set the description of the app
-    App *description(std::string app_description) {
-        description_ = std::move(app_description);
-        return this;
-    }
+    App *description(std::string app_description);
 
     /// Get the list of options (user facing function, so returns raw pointers), has optional filter function
-    std::vector<const Option *> get_options(const std::function<bool(const Option *)> filter = {}) const {
-        std::vector<const Option *> options(options_.size());
-        std::transform(std::begin(options_), std::end(options_), std::begin(options), [](const Option_p &val) {
-            return val.get();
-        });
+    std::vector<const Option *> get_options(const std::function<bool(const Option *)> filter = {}) const;
 
-        if(filter) {
-            options.erase(std::remove_if(std::begin(options),
-                                         std::end(options),
-                                         [&filter](const Option *opt) { return !filter(opt); }),
-                          std::end(options));
-        }
-
-        return options;
-    }
+    /// The options in definition order, as a view that does not allocate
+    PointerView<const Option, Option_p> options_view() const { return PointerView<const Option, Option_p>(options_); }
 
     /// Non-const version of the above
-    std::vector<Option *> get_options(const std::function<bool(Option *)> filter = {}) {
-        std::vector<Option *> options(options_.size());
-        std::transform(std::begin(options_), std::end(options_), std::begin(options), [](const Option_p &val) {
-            return val.get();
-        });
+    PointerView<Option, Option_p> options_view() { return PointerView<Option, Option_p>(options_); }
 
-        if(filter) {
-            options.erase(
-                std::remove_if(std::begin(options), std::end(options), [&filter](Option *opt) { return !filter(opt); }),
-                std::end(options));
+    /// Call visitor with each option in definition order, without allocating
+    template <typename Visitor> void for_each_option(Visitor &&visitor) const {
+        for(const Option_p &opt : options_) {
+            visitor(static_cast<const Option *>(opt.get()));
         }
-
-        return options;
     }
 
-    /// Get an option by name (noexcept non-const version)
-    Option *get_option_no_throw(std::string option_name) noexcept {
-        for(Option_p &opt : options_) {
-            if(opt->check_name(option_name)) {
-                return opt.get();
-            }
-        }
-        for(auto &subc : subcommands_) {
-            // also check down into nameless subcommands
-            if(subc->get_name().empty()) {
-                auto opt = subc->get_option_no_throw(option_name);
-                if(opt != nullptr) {
-                    return opt;
-                }
-            }
+    /// Non-const version of the above
+    template <typename Visitor> void for_each_option(Visitor &&visitor) {
+        for(const Option_p &opt : options_) {
+            visitor(opt.get());
         }
-        return nullptr;
     }
 
+    /// Non-const version of the above
+    std::vector<Option *> get_options(const std::function<bool(Option *)> filter = {});
+
+    /// Get an option by name (noexcept non-const version)
+    Option *get_option_no_throw(std::string option_name) noexcept;
+
     /// Get an option by name (noexcept const version)
-    const Option *get_option_no_throw(std::string option_name) const noexcept {
-        for(const Option_p &opt : options_) {
-            if(opt->check_name(option_name)) {
-                return opt.get();
-            }
-        }
-        for(const auto &subc : subcommands_) {
-            // also check down into nameless subcommands
-            if(subc->get_name().empty()) {
-                auto opt = subc->get_option_no_throw(option_name);
-                if(opt != nullptr) {
-                    return opt;
-                }
-            }
-        }
-        return nullptr;
-    }
+    const Option *get_option_no_throw(std::string option_name) const noexcept;
 
     /// Get an option by name
-    const Option *get_option(std::string option_name) const {
-        auto opt = get_option_no_throw(option_name);
-        if(opt == nullptr) {
-            throw OptionNotFound(option_name);
-        }
-        return opt;
-    }
+    const Option *get_option(std::string option_name) const;
 
     /// Get an option by name (non-const version)
-    Option *get_option(std::string option_name) {
-        auto opt = get_option_no_throw(option_name);
-        if(opt == nullptr) {
-            throw OptionNotFound(option_name);
-        }
-        return opt;
-    }
+    Option *get_option(std::string option_name);
 
     /// Shortcut bracket operator for getting a pointer to an option
     const Option *operator[](const std::string &option_name) const { return get_option(option_name); }
@@ -1671,6 +1646,9 @@ class App {
     /// Check the status of the allow windows style options
     bool get_configurable() const { return configurable_; }
 
+    /// Check the status of help caching
+    bool get_cache_help() const { return cache_help_; }
+
     /// Get the group of this subcommand
     const std::string &get_group() const { return group_; }
 
@@ -1707,6 +1685,24 @@ class App {
     /// Get the status of disabled
     bool get_immediate_callback() const { return immediate_callback_; }
 
+    /// Get the status of recording invocations
+    bool get_record_invocations() const { return record_invocations_; }
+
+    /// The values of every invocation in command line order, when record_invocations is set
+    const std::vector<InvocationRecord> &get_invocations() const { return invocations_; }
+
+    /// Get the status of independent
+    bool get_independent() const { return independent_; }
+
+    /// Get the number of threads for the callbacks of independent subcommands
+    std::size_t get_callback_threads() const { return callback_threads_; }
+
+    /// Get the limits on the size of the input
+    const ParseLimits &get_parse_limits() const { return parse_limits_; }
+
+    /// The profile of the last parse, nullptr unless profiling is enabled
+    const ParseProfile *get_profile() const { return profile_.get(); }
+
     /// Get the status of disabled by default
     bool get_disabled_by_default() const { return (default_startup == startup_mode::disabled); }
 
@@ -1752,122 +1748,38 @@ class App {
     const std::vector<std::string> &get_aliases() const { return aliases_; }
 
     /// clear all the aliases of the current App
-    App *clear_aliases() {
-        aliases_.clear();
-        return this;
-    }
+    App *clear_aliases();
 
     /// Get a display name for an app
-    std::string get_display_name(bool with_aliases = false) const {
-        if(name_.empty()) {
-            return std::string("[Option Group: ") + get_group() + "]";
-        }
-        if(aliases_.empty() || !with_aliases) {
-            return name_;
-        }
-        std::string dispname = name_;
-        for(const auto &lalias : aliases_) {
-            dispname.push_back(',');
-            dispname.push_back(' ');
-            dispname.append(lalias);
-        }
-        return dispname;
-    }
+    std::string get_display_name(bool with_aliases = false) const;
 
     /// Check the name, case insensitive and underscore insensitive if set
-    bool check_name(std::string name_to_check) const {
-        std::string local_name = name_;
-        if(ignore_underscore_) {
-            local_name = detail::remove_underscore(name_);
-            name_to_check = detail::remove_underscore(name_to_check);
-        }
-        if(ignore_case_) {
-            local_name = detail::to_lower(name_);
-            name_to_check = detail::to_lower(name_to_check);
-        }
-
-        if(local_name == name_to_check) {
-            return true;
-        }
-        for(auto les : aliases_) {
-            if(ignore_underscore_) {
-                les = detail::remove_underscore(les);
-            }
-            if(ignore_case_) {
-                les = detail::to_lower(les);
-            }
-            if(les == name_to_check) {
-                return true;
-            }
-        }
-        return false;
-    }
+    bool check_name(std::string name_to_check) const;
 
     /// Get the groups available directly from this option (in order)
-    std::vector<std::string> get_groups() const {
-        std::vector<std::string> groups;
+    std::vector<std::string> get_groups() const;
 
-        for(const Option_p &opt : options_) {
-            // Add group if it is not already in there
-            if(std::find(groups.begin(), groups.end(), opt->get_group()) == groups.end()) {
-                groups.push_back(opt->get_group());
-            }
-        }
+    /// The groups of the options in order of first appearance, as a view that does not allocate
+    GroupView groups_view() const { return GroupView(options_); }
 
-        return groups;
-    }
+    /// This gets the options in the original parse order, once per value
+    std::vector<Option *> parse_order() const { return parse_order_.to_vector(); }
 
-    /// This gets a vector of pointers with the original parse order
-    const std::vector<Option *> &parse_order() const { return parse_order_; }
+    /// The original parse order as runs of values with their argument positions, without expanding it
+    const ParseOrder &parse_order_view() const { return parse_order_; }
 
     /// This returns the missing options from the current subcommand
-    std::vector<std::string> remaining(bool recurse = false) const {
-        std::vector<std::string> miss_list;
-        for(const std::pair<detail::Classifier, std::string> &miss : missing_) {
-            miss_list.push_back(std::get<1>(miss));
-        }
-        // Get from a subcommand that may allow extras
-        if(recurse) {
-            if(!allow_extras_) {
-                for(const auto &sub : subcommands_) {
-                    if(sub->name_.empty() && !sub->missing_.empty()) {
-                        for(const std::pair<detail::Classifier, std::string> &miss : sub->missing_) {
-                            miss_list.push_back(std::get<1>(miss));
-                        }
-                    }
-                }
-            }
-            // Recurse into subcommands
-
-            for(const App *sub : parsed_subcommands_) {
-                std::vector<std::string> output = sub->remaining(recurse);
-                std::copy(std::begin(output), std::end(output), std::back_inserter(miss_list));
-            }
-        }
-        return miss_list;
-    }
+    std::vector<std::string> remaining(bool recurse = false) const;
 
     /// This returns the missing options in a form ready for processing by another command line program
-    std::vector<std::string> remaining_for_passthrough(bool recurse = false) const {
-        std::vector<std::string> miss_list = remaining(recurse);
-        std::reverse(std::begin(miss_list), std::end(miss_list));
-        return miss_list;
-    }
+    std::vector<std::string> remaining_for_passthrough(bool recurse = false) const;
 
     /// This returns the number of remaining options, minus the -- separator
-    std::size_t remaining_size(bool recurse = false) const {
-        auto remaining_options = static_cast<std::size_t>(std::count_if(
-            std::begin(missing_), std::end(missing_), [](const std::pair<detail::Classifier, std::string> &val) {
-                return val.first != detail::Classifier::POSITIONAL_MARK;
-            }));
-
-        if(recurse) {
-            for(const App_p &sub : subcommands_) {
-                remaining_options += sub->remaining_size(recurse);
-            }
-        }
-        return remaining_options;
-    }
+    std::size_t remaining_size(bool recurse = false) const;
+
+    /// The arguments passed through unparsed by prefix_command. When parsing from argc and argv this is a view of the
+    /// end of argv without copies, so it is valid as long as argv; it is also included in remaining.
+    ArgvView passthrough() const;
 
     ///@}
 
@@ -1876,1121 +1788,205 @@ class App {
     ///
     /// Currently checks to see if multiple positionals exist with unlimited args and checks if the min and max options
     /// are feasible
-    void _validate() const {
-        // count the number of positional only args
-        auto pcount = std::count_if(std::begin(options_), std::end(options_), [](const Option_p &opt) {
-            return opt->get_items_expected_max() >= detail::expected_max_vector_size && !opt->nonpositional();
-        });
-        if(pcount > 1) {
-            auto pcount_req = std::count_if(std::begin(options_), std::end(options_), [](const Option_p &opt) {
-                return opt->get_items_expected_max() >= detail::expected_max_vector_size && !opt->nonpositional() &&
-                       opt->get_required();
-            });
-            if(pcount - pcount_req > 1) {
-                throw InvalidError(name_);
-            }
-        }
-
-        std::size_t nameless_subs{0};
-        for(const App_p &app : subcommands_) {
-            app->_validate();
-            if(app->get_name().empty())
-                ++nameless_subs;
-        }
-
-        if(require_option_min_ > 0) {
-            if(require_option_max_ > 0) {
-                if(require_option_max_ < require_option_min_) {
-                    throw(InvalidError("Required min options greater than required max options",
-                                       ExitCodes::InvalidError));
-                }
-            }
-            if(require_option_min_ > (options_.size() + nameless_subs)) {
-                throw(InvalidError("Required min options greater than number of available options",
-                                   ExitCodes::InvalidError));
-            }
-        }
-    }
+    void _validate() const;
 
     /// configure subcommands to enable parsing through the current object
     /// set the correct fallthrough and prefix for nameless subcommands and manage the automatic enable or disable
     /// makes sure parent is set correctly
-    void _configure() {
-        if(default_startup == startup_mode::enabled) {
-            disabled_ = false;
-        } else if(default_startup == startup_mode::disabled) {
-            disabled_ = true;
-        }
-        for(const App_p &app : subcommands_) {
-            if(app->has_automatic_name_) {
-                app->name_.clear();
-            }
-            if(app->name_.empty()) {
-                app->fallthrough_ = false;  // make sure fallthrough_ is false to prevent infinite loop
-                app->prefix_command_ = false;
-            }
-            // make sure the parent is set to be this object in preparation for parse
-            app->parent_ = this;
-            app->_configure();
-        }
-    }
+    void _configure();
 
     /// Internal function to run (App) callback, bottom up
-    void run_callback(bool final_mode = false, bool suppress_final_callback = false) {
-        pre_callback();
-        // in the main app if immediate_callback_ is set it runs the main callback before the used subcommands
-        if(!final_mode && parse_complete_callback_) {
-            parse_complete_callback_();
-        }
-        // run the callbacks for the received subcommands
-        for(App *subc : get_subcommands()) {
-            subc->run_callback(true, suppress_final_callback);
-        }
-        // now run callbacks for option_groups
-        for(auto &subc : subcommands_) {
-            if(subc->name_.empty() && subc->count_all() > 0) {
-                subc->run_callback(true, suppress_final_callback);
-            }
-        }
+    void run_callback(bool final_mode = false, bool suppress_final_callback = false);
 
-        // finally run the main callback
-        if(final_callback_ && (parsed_ > 0) && (!suppress_final_callback)) {
-            if(!name_.empty() || count_all() > 0 || parent_ == nullptr) {
-                final_callback_();
-            }
-        }
-    }
+    /// Run the callbacks of the parsed subcommands, batches of independent ones on callback_threads_ threads
+    void _run_subcommand_callbacks(bool suppress_final_callback);
 
     /// Check to see if a subcommand is valid. Give up immediately if subcommand max has been reached.
-    bool _valid_subcommand(const std::string &current, bool ignore_used = true) const {
-        // Don't match if max has been reached - but still check parents
-        if(require_subcommand_max_ != 0 && parsed_subcommands_.size() >= require_subcommand_max_) {
-            return parent_ != nullptr && parent_->_valid_subcommand(current, ignore_used);
-        }
-        auto com = _find_subcommand(current, true, ignore_used);
-        if(com != nullptr) {
-            return true;
-        }
-        // Check parent if exists, else return false
-        return parent_ != nullptr && parent_->_valid_subcommand(current, ignore_used);
-    }
+    bool _valid_subcommand(const std::string &current, bool ignore_used = true) const;
 
     /// Selects a Classifier enum based on the type of the current argument
-    detail::Classifier _recognize(const std::string &current, bool ignore_used_subcommands = true) const {
-        std::string dummy1, dummy2;
-
-        if(current == "--")
-            return detail::Classifier::POSITIONAL_MARK;
-        if(_valid_subcommand(current, ignore_used_subcommands))
-            return detail::Classifier::SUBCOMMAND;
-        if(detail::split_long(current, dummy1, dummy2))
-            return detail::Classifier::LONG;
-        if(detail::split_short(current, dummy1, dummy2)) {
-            if(dummy1[0] >= '0' && dummy1[0] <= '9') {
-                if(get_option_no_throw(std::string{'-', dummy1[0]}) == nullptr) {
-                    return detail::Classifier::NONE;
-                }
-            }
-            return detail::Classifier::SHORT;
-        }
-        if((allow_windows_style_options_) && (detail::split_windows_style(current, dummy1, dummy2)))
-            return detail::Classifier::WINDOWS_STYLE;
-        if((current == "++") && !name_.empty() && parent_ != nullptr)
-            return detail::Classifier::SUBCOMMAND_TERMINATOR;
-        return detail::Classifier::NONE;
-    }
+    detail::Classifier _recognize(const std::string &current, bool ignore_used_subcommands = true) const;
 
     // The parse function is now broken into several parts, and part of process
 
     /// Read and process a configuration file (main app only)
-    void _process_config_file() {
-        if(config_ptr_ != nullptr) {
-            bool config_required = config_ptr_->get_required();
-            auto file_given = config_ptr_->count() > 0;
-            auto config_files = config_ptr_->as<std::vector<std::string>>();
-            if(config_files.empty() || config_files.front().empty()) {
-                if(config_required) {
-                    throw FileError::Missing("no specified config file");
-                }
-                return;
-            }
-            for(auto rit = config_files.rbegin(); rit != config_files.rend(); ++rit) {
-                const auto &config_file = *rit;
-                auto path_result = detail::check_path(config_file.c_str());
-                if(path_result == detail::path_type::file) {
-                    try {
-                        std::vector<ConfigItem> values = config_formatter_->from_file(config_file);
-                        _parse_config(values);
-                        if(!file_given) {
-                            config_ptr_->add_result(config_file);
-                        }
-                    } catch(const FileError &) {
-                        if(config_required || file_given)
-                            throw;
-                    }
-                } else if(config_required || file_given) {
-                    throw FileError::Missing(config_file);
-                }
-            }
-        }
-    }
+    void _process_config_file();
 
     /// Get envname options if not yet passed. Runs on *all* subcommands.
-    void _process_env() {
-        for(const Option_p &opt : options_) {
-            if(opt->count() == 0 && !opt->envname_.empty()) {
-                char *buffer = nullptr;
-                std::string ename_string;
-
-#ifdef _MSC_VER
-                // Windows version
-                std::size_t sz = 0;
-                if(_dupenv_s(&buffer, &sz, opt->envname_.c_str()) == 0 && buffer != nullptr) {
-                    ename_string = std::string(buffer);
-                    free(buffer);
-                }
-#else
-                // This also works on Windows, but gives a warning
-                buffer = std::getenv(opt->envname_.c_str());
-                if(buffer != nullptr)
-                    ename_string = std::string(buffer);
-#endif
-
-                if(!ename_string.empty()) {
-                    opt->add_result(ename_string);
-                }
-            }
-        }
-
-        for(App_p &sub : subcommands_) {
-            if(sub->get_name().empty() || !sub->parse_complete_callback_)
-                sub->_process_env();
-        }
-    }
+    void _process_env();
 
     /// Process callbacks. Runs on *all* subcommands.
-    void _process_callbacks() {
-
-        for(App_p &sub : subcommands_) {
-            // process the priority option_groups first
-            if(sub->get_name().empty() && sub->parse_complete_callback_) {
-                if(sub->count_all() > 0) {
-                    sub->_process_callbacks();
-                    sub->run_callback();
-                }
-            }
-        }
-
-        for(const Option_p &opt : options_) {
-            if(opt->count() > 0 && !opt->get_callback_run()) {
-                opt->run_callback();
-            }
-        }
-        for(App_p &sub : subcommands_) {
-            if(!sub->parse_complete_callback_) {
-                sub->_process_callbacks();
-            }
-        }
-    }
+    void _process_callbacks();
 
     /// Run help flag processing if any are found.
     ///
     /// The flags allow recursive calls to remember if there was a help flag on a parent.
-    void _process_help_flags(bool trigger_help = false, bool trigger_all_help = false) const {
-        const Option *help_ptr = get_help_ptr();
-        const Option *help_all_ptr = get_help_all_ptr();
-
-        if(help_ptr != nullptr && help_ptr->count() > 0)
-            trigger_help = true;
-        if(help_all_ptr != nullptr && help_all_ptr->count() > 0)
-            trigger_all_help = true;
-
-        // If there were parsed subcommands, call those. First subcommand wins if there are multiple ones.
-        if(!parsed_subcommands_.empty()) {
-            for(const App *sub : parsed_subcommands_)
-                sub->_process_help_flags(trigger_help, trigger_all_help);
-
-            // Only the final subcommand should call for help. All help wins over help.
-        } else if(trigger_all_help) {
-            throw CallForAllHelp();
-        } else if(trigger_help) {
-            throw CallForHelp();
-        }
-    }
-
-    /// Verify required options and cross requirements. Subcommands too (only if selected).
-    void _process_requirements() {
-        // check excludes
-        bool excluded{false};
-        std::string excluder;
-        for(auto &opt : exclude_options_) {
-            if(opt->count() > 0) {
-                excluded = true;
-                excluder = opt->get_name();
-            }
-        }
-        for(auto &subc : exclude_subcommands_) {
-            if(subc->count_all() > 0) {
-                excluded = true;
-                excluder = subc->get_display_name();
-            }
-        }
-        if(excluded) {
-            if(count_all() > 0) {
-                throw ExcludesError(get_display_name(), excluder);
-            }
-            // if we are excluded but didn't receive anything, just return
-            return;
-        }
-
-        // check excludes
-        bool missing_needed{false};
-        std::string missing_need;
-        for(auto &opt : need_options_) {
-            if(opt->count() == 0) {
-                missing_needed = true;
-                missing_need = opt->get_name();
-            }
-        }
-        for(auto &subc : need_subcommands_) {
-            if(subc->count_all() == 0) {
-                missing_needed = true;
-                missing_need = subc->get_display_name();
-            }
-        }
-        if(missing_needed) {
-            if(count_all() > 0) {
-                throw RequiresError(get_display_name(), missing_need);
-            }
-            // if we missing something but didn't have any options, just return
-            return;
-        }
+    void _process_help_flags(bool trigger_help = false,
+                             bool trigger_all_help = false,
+                             std::string search_term = std::string{}) const;
 
-        std::size_t used_options = 0;
-        for(const Option_p &opt : options_) {
+    /// Compile the needs, excludes and required options of the members of this App into requirements_, unless
+    /// nothing changed since the last time
+    void _compile_requirements();
 
-            if(opt->count() != 0) {
-                ++used_options;
-            }
-            // Required but empty
-            if(opt->get_required() && opt->count() == 0) {
-                throw RequiredError(opt->get_name());
-            }
-            // Requires
-            for(const Option *opt_req : opt->needs_)
-                if(opt->count() > 0 && opt_req->count() == 0)
-                    throw RequiresError(opt->get_name(), opt_req->get_name());
-            // Excludes
-            for(const Option *opt_ex : opt->excludes_)
-                if(opt->count() > 0 && opt_ex->count() != 0)
-                    throw ExcludesError(opt->get_name(), opt_ex->get_name());
-        }
-        // check for the required number of subcommands
-        if(require_subcommand_min_ > 0) {
-            auto selected_subcommands = get_subcommands();
-            if(require_subcommand_min_ > selected_subcommands.size())
-                throw RequiredError::Subcommand(require_subcommand_min_);
-        }
-
-        // Max error cannot occur, the extra subcommand will parse as an ExtrasError or a remaining item.
+    /// The name of a member of requirements_ for an error message
+    std::string _requirement_name(std::size_t member) const;
 
-        // run this loop to check how many unnamed subcommands were actually used since they are considered options
-        // from the perspective of an App
-        for(App_p &sub : subcommands_) {
-            if(sub->disabled_)
-                continue;
-            if(sub->name_.empty() && sub->count_all() > 0) {
-                ++used_options;
-            }
-        }
-
-        if(require_option_min_ > used_options || (require_option_max_ > 0 && require_option_max_ < used_options)) {
-            auto option_list = detail::join(options_, [this](const Option_p &ptr) {
-                if(ptr.get() == help_ptr_ || ptr.get() == help_all_ptr_) {
-                    return std::string{};
-                }
-                return ptr->get_name(false, true);
-            });
-
-            auto subc_list = get_subcommands([](App *app) { return ((app->get_name().empty()) && (!app->disabled_)); });
-            if(!subc_list.empty()) {
-                option_list += "," + detail::join(subc_list, [](const App *app) { return app->get_display_name(); });
-            }
-            throw RequiredError::Option(require_option_min_, require_option_max_, used_options, option_list);
-        }
-
-        // now process the requirements for subcommands if needed
-        for(App_p &sub : subcommands_) {
-            if(sub->disabled_)
-                continue;
-            if(sub->name_.empty() && sub->required_ == false) {
-                if(sub->count_all() == 0) {
-                    if(require_option_min_ > 0 && require_option_min_ <= used_options) {
-                        continue;
-                        // if we have met the requirement and there is nothing in this option group skip checking
-                        // requirements
-                    }
-                    if(require_option_max_ > 0 && used_options >= require_option_min_) {
-                        continue;
-                        // if we have met the requirement and there is nothing in this option group skip checking
-                        // requirements
-                    }
-                }
-            }
-            if(sub->count() > 0 || sub->name_.empty()) {
-                sub->_process_requirements();
-            }
-
-            if(sub->required_ && sub->count_all() == 0) {
-                throw(CLI::RequiredError(sub->get_display_name()));
-            }
-        }
-    }
+    /// Verify required options and cross requirements. Subcommands too (only if selected).
+    /// The needs and excludes of this App itself are looked up at position in the requirements of the parent when
+    /// given, which must have been filled for the current parse.
+    void _process_requirements(const Requirements *parent_requirements = nullptr, std::size_t position = 0);
 
     /// Process callbacks and such.
-    void _process() {
-        CLI::FileError fe("ne");
-        bool caught_error{false};
-        try {
-            // the config file might generate a FileError but that should not be processed until later in the process
-            // to allow for help, version and other errors to generate first.
-            _process_config_file();
-            // process env shouldn't throw but no reason to process it if config generated an error
-            _process_env();
-        } catch(const CLI::FileError &fe2) {
-            fe = fe2;
-            caught_error = true;
-        }
-        // callbacks and help_flags can generate exceptions which should take priority over the config file error if one
-        // exists
-        _process_callbacks();
-        _process_help_flags();
-
-        if(caught_error) {
-            throw CLI::FileError(std::move(fe));
-        }
-
-        _process_requirements();
-    }
+    void _process();
 
     /// Throw an error if anything is left over and should not be.
-    void _process_extras() {
-        if(!(allow_extras_ || prefix_command_)) {
-            std::size_t num_left_over = remaining_size();
-            if(num_left_over > 0) {
-                throw ExtrasError(name_, remaining(false));
-            }
-        }
-
-        for(App_p &sub : subcommands_) {
-            if(sub->count() > 0)
-                sub->_process_extras();
-        }
-    }
+    void _process_extras();
 
     /// Throw an error if anything is left over and should not be.
     /// Modifies the args to fill in the missing items before throwing.
-    void _process_extras(std::vector<std::string> &args) {
-        if(!(allow_extras_ || prefix_command_)) {
-            std::size_t num_left_over = remaining_size();
-            if(num_left_over > 0) {
-                args = remaining(false);
-                throw ExtrasError(name_, args);
-            }
-        }
-
-        for(App_p &sub : subcommands_) {
-            if(sub->count() > 0)
-                sub->_process_extras(args);
-        }
-    }
+    void _process_extras(std::vector<std::string> &args);
 
     /// Internal function to recursively increment the parsed counter on the current app as well unnamed subcommands
-    void increment_parsed() {
-        ++parsed_;
-        for(App_p &sub : subcommands_) {
-            if(sub->get_name().empty())
-                sub->increment_parsed();
-        }
-    }
+    void increment_parsed();
     /// Internal parse function
-    void _parse(std::vector<std::string> &args) {
-        increment_parsed();
-        _trigger_pre_parse(args.size());
-        bool positional_only = false;
-
-        while(!args.empty()) {
-            if(!_parse_single(args, positional_only)) {
-                break;
-            }
-        }
-
-        if(parent_ == nullptr) {
-            _process();
-
-            // Throw error if any items are left over (depending on settings)
-            _process_extras(args);
-
-            // Convert missing (pairs) to extras (string only) ready for processing in another app
-            args = remaining_for_passthrough(false);
-        } else if(parse_complete_callback_) {
-            _process_env();
-            _process_callbacks();
-            _process_help_flags();
-            _process_requirements();
-            run_callback(false, true);
-        }
-    }
+    void _parse(std::vector<std::string> &args);
 
     /// Internal parse function
-    void _parse(std::vector<std::string> &&args) {
-        // this can only be called by the top level in which case parent == nullptr by definition
-        // operation is simplified
-        increment_parsed();
-        _trigger_pre_parse(args.size());
-        bool positional_only = false;
-
-        while(!args.empty()) {
-            _parse_single(args, positional_only);
-        }
-        _process();
-
-        // Throw error if any items are left over (depending on settings)
-        _process_extras();
-    }
+    void _parse(std::vector<std::string> &&args);
 
     /// Internal function to parse a stream
-    void _parse_stream(std::istream &input) {
-        auto values = config_formatter_->from_config(input);
-        _parse_config(values);
-        increment_parsed();
-        _trigger_pre_parse(values.size());
-        _process();
-
-        // Throw error if any items are left over (depending on settings)
-        _process_extras();
-    }
+    void _parse_stream(std::istream &input);
 
     /// Parse one config param, return false if not found in any subcommand, remove if it is
     ///
     /// If this has more than one dot.separated.name, go into the subcommand matching it
     /// Returns true if it managed to find the option, if false you'll need to remove the arg manually.
-    void _parse_config(const std::vector<ConfigItem> &args) {
-        for(const ConfigItem &item : args) {
-            if(!_parse_single_config(item) && allow_config_extras_ == config_extras_mode::error)
-                throw ConfigError::Extras(item.fullname());
-        }
-    }
+    void _parse_config(const std::vector<ConfigItem> &args);
 
     /// Fill in a single config option
-    bool _parse_single_config(const ConfigItem &item, std::size_t level = 0) {
-        if(level < item.parents.size()) {
-            try {
-                auto subcom = get_subcommand(item.parents.at(level));
-                auto result = subcom->_parse_single_config(item, level + 1);
-
-                return result;
-            } catch(const OptionNotFound &) {
-                return false;
-            }
-        }
-        // check for section open
-        if(item.name == "++") {
-            if(configurable_) {
-                increment_parsed();
-                _trigger_pre_parse(2);
-                if(parent_ != nullptr) {
-                    parent_->parsed_subcommands_.push_back(this);
-                }
-            }
-            return true;
-        }
-        // check for section close
-        if(item.name == "--") {
-            if(configurable_) {
-                _process_callbacks();
-                _process_requirements();
-                run_callback();
-            }
-            return true;
-        }
-        Option *op = get_option_no_throw("--" + item.name);
-        if(op == nullptr) {
-            if(item.name.size() == 1) {
-                op = get_option_no_throw("-" + item.name);
-            }
-        }
-        if(op == nullptr) {
-            op = get_option_no_throw(item.name);
-        }
-        if(op == nullptr) {
-            // If the option was not present
-            if(get_allow_config_extras() == config_extras_mode::capture)
-                // Should we worry about classifying the extras properly?
-                missing_.emplace_back(detail::Classifier::NONE, item.fullname());
-            return false;
-        }
-
-        if(!op->get_configurable()) {
-            if(get_allow_config_extras() == config_extras_mode::ignore_all) {
-                return false;
-            }
-            throw ConfigError::NotConfigurable(item.fullname());
-        }
-
-        if(op->empty()) {
-            // Flag parsing
-            if(op->get_expected_min() == 0) {
-                auto res = config_formatter_->to_flag(item);
-                res = op->get_flag_value(item.name, res);
-
-                op->add_result(res);
-
-            } else {
-                op->add_result(item.inputs);
-                op->run_callback();
-            }
-        }
-
-        return true;
-    }
+    bool _parse_single_config(const ConfigItem &item, std::size_t level = 0);
 
     /// Parse "one" argument (some may eat more than one), delegate to parent if fails, add to missing if missing
     /// from master return false if the parse has failed and needs to return to parent
-    bool _parse_single(std::vector<std::string> &args, bool &positional_only) {
-        bool retval = true;
-        detail::Classifier classifier = positional_only ? detail::Classifier::NONE : _recognize(args.back());
-        switch(classifier) {
-        case detail::Classifier::POSITIONAL_MARK:
-            args.pop_back();
-            positional_only = true;
-            if((!_has_remaining_positionals()) && (parent_ != nullptr)) {
-                retval = false;
-            } else {
-                _move_to_missing(classifier, "--");
-            }
-            break;
-        case detail::Classifier::SUBCOMMAND_TERMINATOR:
-            // treat this like a positional mark if in the parent app
-            args.pop_back();
-            retval = false;
-            break;
-        case detail::Classifier::SUBCOMMAND:
-            retval = _parse_subcommand(args);
-            break;
-        case detail::Classifier::LONG:
-        case detail::Classifier::SHORT:
-        case detail::Classifier::WINDOWS_STYLE:
-            // If already parsed a subcommand, don't accept options_
-            _parse_arg(args, classifier);
-            break;
-        case detail::Classifier::NONE:
-            // Probably a positional or something for a parent (sub)command
-            retval = _parse_positional(args, false);
-            if(retval && positionals_at_end_) {
-                positional_only = true;
-            }
-            break;
-            // LCOV_EXCL_START
-        default:
-            throw HorribleError("unrecognized classifier (you should not see this!)");
-            // LCOV_EXCL_STOP
-        }
-        return retval;
-    }
+    bool _parse_single(std::vector<std::string> &args, bool &positional_only);
 
     /// Count the required remaining positional arguments
-    std::size_t _count_remaining_positionals(bool required_only = false) const {
-        std::size_t retval = 0;
-        for(const Option_p &opt : options_) {
-            if(opt->get_positional() && (!required_only || opt->get_required())) {
-                if(opt->get_items_expected_min() > 0 &&
-                   static_cast<int>(opt->count()) < opt->get_items_expected_min()) {
-                    retval += static_cast<std::size_t>(opt->get_items_expected_min()) - opt->count();
-                }
-            }
-        }
-        return retval;
-    }
+    std::size_t _count_remaining_positionals(bool required_only = false) const;
 
     /// Count the required remaining positional arguments
-    bool _has_remaining_positionals() const {
-        for(const Option_p &opt : options_) {
-            if(opt->get_positional() && ((static_cast<int>(opt->count()) < opt->get_items_expected_min()))) {
-                return true;
-            }
-        }
-
-        return false;
-    }
+    bool _has_remaining_positionals() const;
 
     /// Parse a positional, go up the tree to check
     /// @param haltOnSubcommand if set to true the operation will not process subcommands merely return false
     /// Return true if the positional was used false otherwise
-    bool _parse_positional(std::vector<std::string> &args, bool haltOnSubcommand) {
-
-        const std::string &positional = args.back();
-
-        if(positionals_at_end_) {
-            // deal with the case of required arguments at the end which should take precedence over other arguments
-            auto arg_rem = args.size();
-            auto remreq = _count_remaining_positionals(true);
-            if(arg_rem <= remreq) {
-                for(const Option_p &opt : options_) {
-                    if(opt->get_positional() && opt->required_) {
-                        if(static_cast<int>(opt->count()) < opt->get_items_expected_min()) {
-                            if(validate_positionals_) {
-                                std::string pos = positional;
-                                pos = opt->_validate(pos, 0);
-                                if(!pos.empty()) {
-                                    continue;
-                                }
-                            }
-                            opt->add_result(positional);
-                            parse_order_.push_back(opt.get());
-                            args.pop_back();
-                            return true;
-                        }
-                    }
-                }
-            }
-        }
-        for(const Option_p &opt : options_) {
-            // Eat options, one by one, until done
-            if(opt->get_positional() &&
-               (static_cast<int>(opt->count()) < opt->get_items_expected_min() || opt->get_allow_extra_args())) {
-                if(validate_positionals_) {
-                    std::string pos = positional;
-                    pos = opt->_validate(pos, 0);
-                    if(!pos.empty()) {
-                        continue;
-                    }
-                }
-                opt->add_result(positional);
-                parse_order_.push_back(opt.get());
-                args.pop_back();
-                return true;
-            }
-        }
-
-        for(auto &subc : subcommands_) {
-            if((subc->name_.empty()) && (!subc->disabled_)) {
-                if(subc->_parse_positional(args, false)) {
-                    if(!subc->pre_parse_called_) {
-                        subc->_trigger_pre_parse(args.size());
-                    }
-                    return true;
-                }
-            }
-        }
-        // let the parent deal with it if possible
-        if(parent_ != nullptr && fallthrough_)
-            return _get_fallthrough_parent()->_parse_positional(args, static_cast<bool>(parse_complete_callback_));
-
-        /// Try to find a local subcommand that is repeated
-        auto com = _find_subcommand(args.back(), true, false);
-        if(com != nullptr && (require_subcommand_max_ == 0 || require_subcommand_max_ > parsed_subcommands_.size())) {
-            if(haltOnSubcommand) {
-                return false;
-            }
-            args.pop_back();
-            com->_parse(args);
-            return true;
-        }
-        /// now try one last gasp at subcommands that have been executed before, go to root app and try to find a
-        /// subcommand in a broader way, if one exists let the parent deal with it
-        auto parent_app = (parent_ != nullptr) ? _get_fallthrough_parent() : this;
-        com = parent_app->_find_subcommand(args.back(), true, false);
-        if(com != nullptr && (com->parent_->require_subcommand_max_ == 0 ||
-                              com->parent_->require_subcommand_max_ > com->parent_->parsed_subcommands_.size())) {
-            return false;
-        }
-
-        if(positionals_at_end_) {
-            throw CLI::ExtrasError(name_, args);
-        }
-        /// If this is an option group don't deal with it
-        if(parent_ != nullptr && name_.empty()) {
-            return false;
-        }
-        /// We are out of other options this goes to missing
-        _move_to_missing(detail::Classifier::NONE, positional);
-        args.pop_back();
-        if(prefix_command_) {
-            while(!args.empty()) {
-                _move_to_missing(detail::Classifier::NONE, args.back());
-                args.pop_back();
-            }
-        }
-
-        return true;
-    }
+    bool _parse_positional(std::vector<std::string> &args, bool haltOnSubcommand);
 
     /// Locate a subcommand by name with two conditions, should disabled subcommands be ignored, and should used
     /// subcommands be ignored
-    App *_find_subcommand(const std::string &subc_name, bool ignore_disabled, bool ignore_used) const noexcept {
-        for(const App_p &com : subcommands_) {
-            if(com->disabled_ && ignore_disabled)
-                continue;
-            if(com->get_name().empty()) {
-                auto subc = com->_find_subcommand(subc_name, ignore_disabled, ignore_used);
-                if(subc != nullptr) {
-                    return subc;
-                }
-            }
-            if(com->check_name(subc_name)) {
-                if((!*com) || !ignore_used)
-                    return com.get();
-            }
-        }
-        return nullptr;
-    }
+    App *_find_subcommand(const std::string &subc_name, bool ignore_disabled, bool ignore_used) const noexcept;
 
     /// Parse a subcommand, modify args and continue
     ///
     /// Unlike the others, this one will always allow fallthrough
     /// return true if the subcommand was processed false otherwise
-    bool _parse_subcommand(std::vector<std::string> &args) {
-        if(_count_remaining_positionals(/* required */ true) > 0) {
-            _parse_positional(args, false);
-            return true;
-        }
-        auto com = _find_subcommand(args.back(), true, true);
-        if(com != nullptr) {
-            args.pop_back();
-            if(!com->silent_) {
-                parsed_subcommands_.push_back(com);
-            }
-            com->_parse(args);
-            auto parent_app = com->parent_;
-            while(parent_app != this) {
-                parent_app->_trigger_pre_parse(args.size());
-                if(!com->silent_) {
-                    parent_app->parsed_subcommands_.push_back(com);
-                }
-                parent_app = parent_app->parent_;
-            }
-            return true;
-        }
-
-        if(parent_ == nullptr)
-            throw HorribleError("Subcommand " + args.back() + " missing");
-        return false;
-    }
+    bool _parse_subcommand(std::vector<std::string> &args);
 
     /// Parse a short (false) or long (true) argument, must be at the top of the list
     /// return true if the argument was processed or false if nothing was done
-    bool _parse_arg(std::vector<std::string> &args, detail::Classifier current_type) {
-
-        std::string current = args.back();
-
-        std::string arg_name;
-        std::string value;
-        std::string rest;
-
-        switch(current_type) {
-        case detail::Classifier::LONG:
-            if(!detail::split_long(current, arg_name, value))
-                throw HorribleError("Long parsed but missing (you should not see this):" + args.back());
-            break;
-        case detail::Classifier::SHORT:
-            if(!detail::split_short(current, arg_name, rest))
-                throw HorribleError("Short parsed but missing! You should not see this");
-            break;
-        case detail::Classifier::WINDOWS_STYLE:
-            if(!detail::split_windows_style(current, arg_name, value))
-                throw HorribleError("windows option parsed but missing! You should not see this");
-            break;
-        case detail::Classifier::SUBCOMMAND:
-        case detail::Classifier::SUBCOMMAND_TERMINATOR:
-        case detail::Classifier::POSITIONAL_MARK:
-        case detail::Classifier::NONE:
-        default:
-            throw HorribleError("parsing got called with invalid option! You should not see this");
-        }
-
-        auto op_ptr =
-            std::find_if(std::begin(options_), std::end(options_), [arg_name, current_type](const Option_p &opt) {
-                if(current_type == detail::Classifier::LONG)
-                    return opt->check_lname(arg_name);
-                if(current_type == detail::Classifier::SHORT)
-                    return opt->check_sname(arg_name);
-                // this will only get called for detail::Classifier::WINDOWS_STYLE
-                return opt->check_lname(arg_name) || opt->check_sname(arg_name);
-            });
-
-        // Option not found
-        if(op_ptr == std::end(options_)) {
-            for(auto &subc : subcommands_) {
-                if(subc->name_.empty() && !subc->disabled_) {
-                    if(subc->_parse_arg(args, current_type)) {
-                        if(!subc->pre_parse_called_) {
-                            subc->_trigger_pre_parse(args.size());
-                        }
-                        return true;
-                    }
-                }
-            }
-            // If a subcommand, try the master command
-            if(parent_ != nullptr && fallthrough_)
-                return _get_fallthrough_parent()->_parse_arg(args, current_type);
-            // don't capture missing if this is a nameless subcommand
-            if(parent_ != nullptr && name_.empty()) {
-                return false;
-            }
-            // Otherwise, add to missing
-            args.pop_back();
-            _move_to_missing(current_type, current);
-            return true;
-        }
+    bool _parse_arg(std::vector<std::string> &args, detail::Classifier current_type);
 
-        args.pop_back();
+    /// Add a value from the input to an option, enforcing the value and nesting limits
+    void _add_input(Option *op, std::string &&value, int &results_added);
 
-        // Get a reference to the pointer to make syntax bearable
-        Option_p &op = *op_ptr;
-        /// if we require a separator add it here
-        if(op->get_inject_separator()) {
-            if(!op->results().empty() && !op->results().back().empty()) {
-                op->add_result(std::string{});
-            }
-        }
-        int min_num = (std::min)(op->get_type_size_min(), op->get_items_expected_min());
-        int max_num = op->get_items_expected_max();
-        // check container like options to limit the argument size to a single type if the allow_extra_flags argument is
-        // set. 16 is somewhat arbitrary (needs to be at least 4)
-        if(max_num >= detail::expected_max_vector_size / 16 && !op->get_allow_extra_args()) {
-            auto tmax = op->get_type_size_max();
-            max_num = detail::checked_multiply(tmax, op->get_expected_min()) ? tmax : detail::expected_max_vector_size;
-        }
-        // Make sure we always eat the minimum for unlimited vectors
-        int collected = 0;     // total number of arguments collected
-        int result_count = 0;  // local variable for number of results in a single arg string
-        // deal with purely flag like things
-        if(max_num == 0) {
-            auto res = op->get_flag_value(arg_name, value);
-            op->add_result(res);
-            parse_order_.push_back(op.get());
-        } else if(!value.empty()) {  // --this=value
-            op->add_result(value, result_count);
-            parse_order_.push_back(op.get());
-            collected += result_count;
-            // -Trest
-        } else if(!rest.empty()) {
-            op->add_result(rest, result_count);
-            parse_order_.push_back(op.get());
-            rest = "";
-            collected += result_count;
-        }
+    /// Enforce the nesting limit on a vector string about to be added to op
+    void _check_input_depth(const Option *op, const std::string &value) const;
 
-        // gather the minimum number of arguments
-        while(min_num > collected && !args.empty()) {
-            std::string current_ = args.back();
-            args.pop_back();
-            op->add_result(current_, result_count);
-            parse_order_.push_back(op.get());
-            collected += result_count;
-        }
+    /// Enforce the value limit on op after values were added
+    void _check_input_values(const Option *op) const;
 
-        if(min_num > collected) {  // if we have run out of arguments and the minimum was not met
-            throw ArgumentMismatch::TypedAtLeast(op->get_name(), min_num, op->get_type_name());
-        }
+    /// Enforce the token and byte limits on the arguments given to parse
+    void _check_input_size(const std::vector<std::string> &args) const;
 
-        if(max_num > collected || op->get_allow_extra_args()) {  // we allow optional arguments
-            auto remreqpos = _count_remaining_positionals(true);
-            // we have met the minimum now optionally check up to the maximum
-            while((collected < max_num || op->get_allow_extra_args()) && !args.empty() &&
-                  _recognize(args.back(), false) == detail::Classifier::NONE) {
-                // If any required positionals remain, don't keep eating
-                if(remreqpos >= args.size()) {
-                    break;
-                }
-
-                op->add_result(args.back(), result_count);
-                parse_order_.push_back(op.get());
-                args.pop_back();
-                collected += result_count;
-            }
+    /// Enforce the nesting limit on a subcommand about to be parsed
+    void _check_subcommand_depth(const App *com) const;
 
-            // Allow -- to end an unlimited list and "eat" it
-            if(!args.empty() && _recognize(args.back()) == detail::Classifier::POSITIONAL_MARK)
-                args.pop_back();
-            // optional flag that didn't receive anything now get the default value
-            if(min_num == 0 && max_num > 0 && collected == 0) {
-                auto res = op->get_flag_value(arg_name, std::string{});
-                op->add_result(res);
-                parse_order_.push_back(op.get());
-            }
-        }
+    /// Stop parsing for prefix_command, passing all remaining arguments through
+    void _pass_through(std::vector<std::string> &args);
 
-        // if we only partially completed a type then add an empty string for later processing
-        if(min_num > 0 && op->get_type_size_max() != min_num && (collected % op->get_type_size_max()) != 0) {
-            op->add_result(std::string{});
-        }
+    /// Split a command line given to parse as a string into reversed arguments
+    std::vector<std::string> _split_commandline(std::string commandline, bool program_name_included);
 
-        if(!rest.empty()) {
-            rest = "-" + rest;
-            args.push_back(rest);
-        }
-        return true;
-    }
+    /// Share profile with this App and all of its subcommands
+    void _set_profile(const std::shared_ptr<ParseProfile> &profile);
 
     /// Trigger the pre_parse callback if needed
-    void _trigger_pre_parse(std::size_t remaining_args) {
-        if(!pre_parse_called_) {
-            pre_parse_called_ = true;
-            if(pre_parse_callback_) {
-                pre_parse_callback_(remaining_args);
-            }
-        } else if(immediate_callback_) {
-            if(!name_.empty()) {
-                auto pcnt = parsed_;
-                auto extras = std::move(missing_);
-                clear();
-                parsed_ = pcnt;
-                pre_parse_called_ = true;
-                missing_ = std::move(extras);
-            }
-        }
-    }
+    void _trigger_pre_parse(std::size_t remaining_args);
+
+    /// Add a record of the current invocation to invocations_. With reset the values are moved into the record and
+    /// the options, option groups and subcommands that were used are cleared for the next invocation.
+    void _record_invocation(bool reset);
+
+    /// Add the values of the options of this App and its option groups to record, moving them if reset is set
+    void _add_to_record(InvocationRecord &record, bool reset);
+
+    /// Finish the counted flag occurrences of all options in this App and its subcommands
+    void _finish_flag_counts();
+
+    /// Record the last invocation of every subcommand that records invocations
+    void _record_final_invocations();
+
+    /// Extend the help name prefix and find the App whose help is shown (the selected subcommand, if any)
+    const App *_help_app(std::string &prev) const;
+
+    /// Get the cached help for prev and mode, rendering it if stale; help_cache_mutex_ must be held
+    const std::string &_cached_help(std::string prev, AppFormatMode mode) const;
+
+    /// Find the entries of help_index_ that match every word of term, rebuilding the index if stale;
+    /// help_cache_mutex_ must be held
+    std::vector<HelpMatch> _search_help(const std::string &term) const;
+
+    /// Add the visible options and subcommands of app to help_index_, as listed in the help of owner
+    void _index_help(const App *owner, const App *app) const;
+
+    /// Add an entry to help_index_ under each word of its help text
+    void _index_help_entry(HelpMatch entry, const std::string &text) const;
+
+    /// Append the JSON description of this App and its subcommands to out
+    void _export_json(std::string &out) const;
+
+    /// Append the JSON description of an option to out
+    static void _export_option_json(std::string &out, const Option *opt);
+
+    /// Split text into lowercase words of letters and digits
+    static std::vector<std::string> _help_words(const std::string &text);
+
+    /// Check if a value given to the help flag is a search term rather than a flag value like true or 2
+    static bool _is_help_search_term(const std::string &value);
+
+    /// The position in the command line of the argument at the back of args
+    std::size_t _arg_position(const std::vector<std::string> &args) const;
 
     /// Get the appropriate parent to fallthrough to which is the first one that has a name or the main app
-    App *_get_fallthrough_parent() {
-        if(parent_ == nullptr) {
-            throw(HorribleError("No Valid parent"));
-        }
-        auto fallthrough_parent = parent_;
-        while((fallthrough_parent->parent_ != nullptr) && (fallthrough_parent->get_name().empty())) {
-            fallthrough_parent = fallthrough_parent->parent_;
-        }
-        return fallthrough_parent;
-    }
+    App *_get_fallthrough_parent();
 
     /// Helper function to run through all possible comparisons of subcommand names to check there is no overlap
-    const std::string &_compare_subcommand_names(const App &subcom, const App &base) const {
-        static const std::string estring;
-        if(subcom.disabled_) {
-            return estring;
-        }
-        for(auto &subc : base.subcommands_) {
-            if(subc.get() != &subcom) {
-                if(subc->disabled_) {
-                    continue;
-                }
-                if(!subcom.get_name().empty()) {
-                    if(subc->check_name(subcom.get_name())) {
-                        return subcom.get_name();
-                    }
-                }
-                if(!subc->get_name().empty()) {
-                    if(subcom.check_name(subc->get_name())) {
-                        return subc->get_name();
-                    }
-                }
-                for(const auto &les : subcom.aliases_) {
-                    if(subc->check_name(les)) {
-                        return les;
-                    }
-                }
-                // this loop is needed in case of ignore_underscore or ignore_case on one but not the other
-                for(const auto &les : subc->aliases_) {
-                    if(subcom.check_name(les)) {
-                        return les;
-                    }
-                }
-                // if the subcommand is an option group we need to check deeper
-                if(subc->get_name().empty()) {
-                    auto &cmpres = _compare_subcommand_names(subcom, *subc);
-                    if(!cmpres.empty()) {
-                        return cmpres;
-                    }
-                }
-                // if the test subcommand is an option group we need to check deeper
-                if(subcom.get_name().empty()) {
-                    auto &cmpres = _compare_subcommand_names(*subc, subcom);
-                    if(!cmpres.empty()) {
-                        return cmpres;
-                    }
-                }
-            }
-        }
-        return estring;
-    }
+    const std::string &_compare_subcommand_names(const App &subcom, const App &base) const;
     /// Helper function to place extra values in the most appropriate position
-    void _move_to_missing(detail::Classifier val_type, const std::string &val) {
-        if(allow_extras_ || subcommands_.empty()) {
-            missing_.emplace_back(val_type, val);
-            return;
-        }
-        // allow extra arguments to be places in an option group if it is allowed there
-        for(auto &subc : subcommands_) {
-            if(subc->name_.empty() && subc->allow_extras_) {
-                subc->missing_.emplace_back(val_type, val);
-                return;
-            }
-        }
-        // if we haven't found any place to put them yet put them in missing
-        missing_.emplace_back(val_type, val);
-    }
+    void _move_to_missing(detail::Classifier val_type, const std::string &val);
 
   public:
     /// function that could be used by subclasses of App to shift options around into subcommands
-    void _move_option(Option *opt, App *app) {
-        if(opt == nullptr) {
-            throw OptionNotFound("the option is NULL");
-        }
-        // verify that the give app is actually a subcommand
-        bool found = false;
-        for(auto &subc : subcommands_) {
-            if(app == subc.get()) {
-                found = true;
-            }
-        }
-        if(!found) {
-            throw OptionNotFound("The Given app is not a subcommand");
-        }
-
-        if((help_ptr_ == opt) || (help_all_ptr_ == opt))
-            throw OptionAlreadyAdded("cannot move help options");
-
-        if(config_ptr_ == opt)
-            throw OptionAlreadyAdded("cannot move config file options");
-
-        auto iterator =
-            std::find_if(std::begin(options_), std::end(options_), [opt](const Option_p &v) { return v.get() == opt; });
-        if(iterator != std::end(options_)) {
-            const auto &opt_p = *iterator;
-            if(std::find_if(std::begin(app->options_), std::end(app->options_), [&opt_p](const Option_p &v) {
-                   return (*v == *opt_p);
-               }) == std::end(app->options_)) {
-                // only erase after the insertion was successful
-                app->options_.push_back(std::move(*iterator));
-                options_.erase(iterator);
-            } else {
-                throw OptionAlreadyAdded("option was not located: " + opt->get_name());
-            }
-        } else {
-            throw OptionNotFound("could not locate the given Option");
-        }
-    }
+    void _move_option(Option *opt, App *app);
 };  // namespace CLI
 
 /// Extension of App to better manage groups of options
 class Option_group : public App {
   public:
-    Option_group(std::string group_description, std::string group_name, App *parent)
-        : App(std::move(group_description), "", parent) {
-        group(group_name);
-        // option groups should have automatic fallthrough
-    }
+    Option_group(std::string group_description, std::string group_name, App *parent);
     using App::add_option;
     /// Add an existing option to the Option_group
-    Option *add_option(Option *opt) {
-        if(get_parent() == nullptr) {
-            throw OptionNotFound("Unable to locate the specified option");
-        }
-        get_parent()->_move_option(opt, this);
-        return opt;
-    }
+    Option *add_option(Option *opt);
     /// Add an existing option to the Option_group
     void add_options(Option *opt) { add_option(opt); }
     /// Add a bunch of options to the group
@@ -3000,130 +1996,37 @@ class Option_group : public App {
     }
     using App::add_subcommand;
     /// Add an existing subcommand to be a member of an option_group
-    App *add_subcommand(App *subcom) {
-        App_p subc = subcom->get_parent()->get_subcommand_ptr(subcom);
-        subc->get_parent()->remove_subcommand(subcom);
-        add_subcommand(std::move(subc));
-        return subcom;
-    }
+    App *add_subcommand(App *subcom);
 };
 /// Helper function to enable one option group/subcommand when another is used
-inline void TriggerOn(App *trigger_app, App *app_to_enable) {
-    app_to_enable->enabled_by_default(false);
-    app_to_enable->disabled_by_default();
-    trigger_app->preparse_callback([app_to_enable](std::size_t) { app_to_enable->disabled(false); });
-}
+CLI11_INLINE void TriggerOn(App *trigger_app, App *app_to_enable);
 
 /// Helper function to enable one option group/subcommand when another is used
-inline void TriggerOn(App *trigger_app, std::vector<App *> apps_to_enable) {
-    for(auto &app : apps_to_enable) {
-        app->enabled_by_default(false);
-        app->disabled_by_default();
-    }
-
-    trigger_app->preparse_callback([apps_to_enable](std::size_t) {
-        for(auto &app : apps_to_enable) {
-            app->disabled(false);
-        }
-    });
-}
+CLI11_INLINE void TriggerOn(App *trigger_app, std::vector<App *> apps_to_enable);
 
 /// Helper function to disable one option group/subcommand when another is used
-inline void TriggerOff(App *trigger_app, App *app_to_enable) {
-    app_to_enable->disabled_by_default(false);
-    app_to_enable->enabled_by_default();
-    trigger_app->preparse_callback([app_to_enable](std::size_t) { app_to_enable->disabled(); });
-}
+CLI11_INLINE void TriggerOff(App *trigger_app, App *app_to_enable);
 
 /// Helper function to disable one option group/subcommand when another is used
-inline void TriggerOff(App *trigger_app, std::vector<App *> apps_to_enable) {
-    for(auto &app : apps_to_enable) {
-        app->disabled_by_default(false);
-        app->enabled_by_default();
-    }
-
-    trigger_app->preparse_callback([apps_to_enable](std::size_t) {
-        for(auto &app : apps_to_enable) {
-            app->disabled();
-        }
-    });
-}
+CLI11_INLINE void TriggerOff(App *trigger_app, std::vector<App *> apps_to_enable);
 
 /// Helper function to mark an option as deprecated
-inline void deprecate_option(Option *opt, const std::string &replacement = "") {
-    Validator deprecate_warning{[opt, replacement](std::string &) {
-                                    std::cout << opt->get_name() << " is deprecated please use '" << replacement
-                                              << "' instead\n";
-                                    return std::string();
-                                },
-                                "DEPRECATED"};
-    deprecate_warning.application_index(0);
-    opt->check(deprecate_warning);
-    if(!replacement.empty()) {
-        opt->description(opt->get_description() + " DEPRECATED: please use '" + replacement + "' instead");
-    }
-}
+CLI11_INLINE void deprecate_option(Option *opt, const std::string &replacement = "");
 
 /// Helper function to mark an option as deprecated
-inline void deprecate_option(App *app, const std::string &option_name, const std::string &replacement = "") {
-    auto opt = app->get_option(option_name);
-    deprecate_option(opt, replacement);
-}
+CLI11_INLINE void deprecate_option(App *app, const std::string &option_name, const std::string &replacement = "");
 
 /// Helper function to mark an option as deprecated
-inline void deprecate_option(App &app, const std::string &option_name, const std::string &replacement = "") {
-    auto opt = app.get_option(option_name);
-    deprecate_option(opt, replacement);
-}
+CLI11_INLINE void deprecate_option(App &app, const std::string &option_name, const std::string &replacement = "");
 
 /// Helper function to mark an option as retired
-inline void retire_option(App *app, Option *opt) {
-    App temp;
-    auto option_copy = temp.add_option(opt->get_name(false, true))
-                           ->type_size(opt->get_type_size_min(), opt->get_type_size_max())
-                           ->expected(opt->get_expected_min(), opt->get_expected_max())
-                           ->allow_extra_args(opt->get_allow_extra_args());
-
-    app->remove_option(opt);
-    auto opt2 = app->add_option(option_copy->get_name(false, true), "option has been retired and has no effect")
-                    ->type_name("RETIRED")
-                    ->default_str("RETIRED")
-                    ->type_size(option_copy->get_type_size_min(), option_copy->get_type_size_max())
-                    ->expected(option_copy->get_expected_min(), option_copy->get_expected_max())
-                    ->allow_extra_args(option_copy->get_allow_extra_args());
-
-    Validator retired_warning{[opt2](std::string &) {
-                                  std::cout << "WARNING " << opt2->get_name() << " is retired and has no effect\n";
-                                  return std::string();
-                              },
-                              ""};
-    retired_warning.application_index(0);
-    opt2->check(retired_warning);
-}
+CLI11_INLINE void retire_option(App *app, Option *opt);
 
 /// Helper function to mark an option as retired
 inline void retire_option(App &app, Option *opt) { retire_option(&app, opt); }
 
 /// Helper function to mark an option as retired
-inline void retire_option(App *app, const std::string &option_name) {
-
-    auto opt = app->get_option_no_throw(option_name);
-    if(opt != nullptr) {
-        retire_option(app, opt);
-        return;
-    }
-    auto opt2 = app->add_option(option_name, "option has been retired and has no effect")
-                    ->type_name("RETIRED")
-                    ->expected(0, 1)
-                    ->default_str("RETIRED");
-    Validator retired_warning{[opt2](std::string &) {
-                                  std::cout << "WARNING " << opt2->get_name() << " is retired and has no effect\n";
-                                  return std::string();
-                              },
-                              ""};
-    retired_warning.application_index(0);
-    opt2->check(retired_warning);
-}
+CLI11_INLINE void retire_option(App *app, const std::string &option_name);
 
 /// Helper function to mark an option as retired
 inline void retire_option(App &app, const std::string &option_name) { retire_option(&app, option_name); }
@@ -3131,30 +2034,10 @@ inline void retire_option(App &app, const std::string &option_name) { retire_opt
 namespace FailureMessage {
 
 /// Printout a clean, simple message on error (the default in CLI11 1.5+)
-inline std::string simple(const App *app, const Error &e) {
-    std::string header = std::string(e.what()) + "\n";
-    std::vector<std::string> names;
-
-    // Collect names
-    if(app->get_help_ptr() != nullptr)
-        names.push_back(app->get_help_ptr()->get_name());
-
-    if(app->get_help_all_ptr() != nullptr)
-        names.push_back(app->get_help_all_ptr()->get_name());
-
-    // If any names found, suggest those
-    if(!names.empty())
-        header += "Run with " + detail::join(names, " or ") + " for more information.\n";
-
-    return header;
-}
+CLI11_INLINE std::string simple(const App *app, const Error &e);
 
 /// Printout the full help string on error (if this fn is set, the old default for CLI11)
-inline std::string help(const App *app, const Error &e) {
-    std::string header = std::string("ERROR: ") + e.get_name() + ": " + e.what() + "\n";
-    header += app->help();
-    return header;
-}
+CLI11_INLINE std::string help(const App *app, const Error &e);
 
 }  // namespace FailureMessage
 
@@ -3194,3 +2077,7 @@ struct AppFriend {
 
 // [CLI11:app_hpp:end]
 }  // namespace CLI
+
+#ifndef CLI11_COMPILE
+#include "impl/App_inl.hpp"
+#endif
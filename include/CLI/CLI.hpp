@@ -31,6 +31,8 @@
 
 #include "App.hpp"
 
+#include "Schema.hpp"
+
 #include "Config.hpp"
 
 #include "Formatter.hpp"
@@ -18,8 +18,6 @@
 #include "Error.hpp"
 #include "StringTools.hpp"
 
-#include <toml11/toml.hpp>
-
 namespace CLI {
 // [CLI11:config_fwd_hpp:verbatim]
 
@@ -179,65 +177,5 @@ class ConfigINI : public ConfigBase {
     }
 };
 
-/// ConfigTOML generates a TOML v1.0 compliant output
-///
-/// Based on https://github.com/ToruNiina/toml11.git
-///
-/// The template typename T corresponds to the unit of std::chrono::duration, used for TOML's local time entries
-/// By default (see ConfigTOML alias below), T is taken to be std::chrono::seconds
-template <typename T = std::chrono::seconds> class ConfigTOML : public Config {
-  private:
-    /// Defines stuff
-#define DEFAULT_TIME_FORMAT "%Y-%m-%d %H:%M:%S %Z"
-    /// Default format used to convert offset datetime, local datetime,
-    /// and local date TOML entries to string
-    std::string time_format = DEFAULT_TIME_FORMAT;
-
-    /// Boolean: convert offset datetime, local datetime, and local date TOML entries
-    /// to local timezone std::chrono::time_points Otherwise: convert to UTC time
-    bool use_local_timezone = true;
-
-    /// Unit of time for TOML local time entries
-    T time_unit;
-
-  public:
-    //   Constructors
-    /// Default Constructor
-    ConfigTOML(){};
-
-    /// Constructors allowing user to set time_format string
-    /// \param time_format String containing format of time
-    ConfigTOML(const std::string &time_format) : time_format(time_format){};
-    ConfigTOML(const std::string &&time_format) : time_format(std::move(time_format)){};
-
-    /// Constructors allowing user to set use_local_timezone boolean and (if desired) time_format string (defaults to
-    /// DEFAULT_TIME_FORMAT)
-    ConfigTOML(const bool &use_local_timezone, const std::string &time_format = DEFAULT_TIME_FORMAT)
-        : use_local_timezone(use_local_timezone), time_format(time_format){};
-    ConfigTOML(const bool &use_local_timezone, const std::string &&time_format = DEFAULT_TIME_FORMAT)
-        : use_local_timezone(use_local_timezone), time_format(std::move(time_format)){};
-
-    /// Convert current set of command line arguments to TOML config file
-    std::string to_config(const App *app, bool default_also, bool write_description, std::string prefix) const override;
-
-    /// Convert TOML config file to current set of Command Line Arguments (overridden by user input command line args)
-    std::vector<ConfigItem> from_config(std::istream &input) const override;
-
-  private:
-    /// Used internally by from_config
-    std::vector<ConfigItem> _from_config(toml::basic_value<toml::preserve_comments> j,
-                                         std::string name = "",
-                                         std::vector<std::string> prefix = {}) const;
-
-    /// Parse a toml::array (with comments preserved), that is a std::vector<toml::value>.
-    /// The elements of the array can be tables or arrays themselves. The former case will raise an error, since no
-    /// valid conversion was found to be appropriate. Arrays of arrays are parsed recursively.
-    /// \return Vector of strings, each string representing an element of the array (or of the subarrays)
-    std::vector<std::string> parse_toml_array(toml::value array, const std::string &key) const;
-
-    template<typename toml_type>
-    toml_type dump_toml_value(const CLI::Option &opt) const;
-};
-
 // [CLI11:config_fwd_hpp:end]
 }  // namespace CLI
@@ -0,0 +1,397 @@
+// Copyright (c) 2017-2021, University of Cincinnati, developed by Henry Schreiner
+// under NSF AWARD 1414736 and by the respective contributors.
+// All rights reserved.
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+// [CLI11:public_includes:set]
+#include <chrono>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+// [CLI11:public_includes:end]
+
+#include "App.hpp"
+#include "Config.hpp"
+
+#include <toml11/toml.hpp>
+
+namespace CLI {
+// [CLI11:config_toml_hpp:verbatim]
+
+/// ConfigTOML generates a TOML v1.0 compliant output
+///
+/// Based on https://github.com/ToruNiina/toml11.git
+///
+/// The template typename T corresponds to the unit of std::chrono::duration, used for TOML's local time entries
+/// By default (see ConfigTOML alias below), T is taken to be std::chrono::seconds
+template <typename T = std::chrono::seconds> class ConfigTOML : public Config {
+  private:
+    /// Defines stuff
+#define DEFAULT_TIME_FORMAT "%Y-%m-%d %H:%M:%S %Z"
+    /// Default format used to convert offset datetime, local datetime,
+    /// and local date TOML entries to string
+    std::string time_format = DEFAULT_TIME_FORMAT;
+
+    /// Boolean: convert offset datetime, local datetime, and local date TOML entries
+    /// to local timezone std::chrono::time_points Otherwise: convert to UTC time
+    bool use_local_timezone = true;
+
+    /// Unit of time for TOML local time entries
+    T time_unit;
+
+  public:
+    //   Constructors
+    /// Default Constructor
+    ConfigTOML(){};
+
+    /// Constructors allowing user to set time_format string
+    /// \param time_format String containing format of time
+    ConfigTOML(const std::string &time_format) : time_format(time_format){};
+    ConfigTOML(const std::string &&time_format) : time_format(std::move(time_format)){};
+
+    /// Constructors allowing user to set use_local_timezone boolean and (if desired) time_format string (defaults to
+    /// DEFAULT_TIME_FORMAT)
+    ConfigTOML(const bool &use_local_timezone, const std::string &time_format = DEFAULT_TIME_FORMAT)
+        : use_local_timezone(use_local_timezone), time_format(time_format){};
+    ConfigTOML(const bool &use_local_timezone, const std::string &&time_format = DEFAULT_TIME_FORMAT)
+        : use_local_timezone(use_local_timezone), time_format(std::move(time_format)){};
+
+    /// Convert current set of command line arguments to TOML config file
+    std::string to_config(const App *app, bool default_also, bool write_description, std::string prefix) const override;
+
+    /// Convert TOML config file to current set of Command Line Arguments (overridden by user input command line args)
+    std::vector<ConfigItem> from_config(std::istream &input) const override;
+
+  private:
+    /// Used internally by from_config
+    std::vector<ConfigItem> _from_config(toml::basic_value<toml::preserve_comments> j,
+                                         std::string name = "",
+                                         std::vector<std::string> prefix = {}) const;
+
+    /// Parse a toml::array (with comments preserved), that is a std::vector<toml::value>.
+    /// The elements of the array can be tables or arrays themselves. The former case will raise an error, since no
+    /// valid conversion was found to be appropriate. Arrays of arrays are parsed recursively.
+    /// \return Vector of strings, each string representing an element of the array (or of the subarrays)
+    std::vector<std::string> parse_toml_array(toml::value array, const std::string &key) const;
+
+    template<typename toml_type>
+    toml_type dump_toml_value(const CLI::Option &opt) const;
+};
+
+namespace detail {
+template <typename T> std::vector<std::string> get_description_for_TOML(T *CLI_obj) {
+    // Get description of CLI::App/CLI::Option
+    // Place each line of the string in a string vector element, separating lines by '\n'
+    // Return rvalue of string vector
+    std::istringstream desc_stream(CLI_obj->get_description());
+    std::vector<std::string> lines;
+    std::string _line;
+    while(getline(desc_stream, _line)) {
+        // Add a trailing space for readability if whitespace is not present at beginning of line
+        if(!isspace(_line.at(0)))
+            _line.insert(0, 1, ' ');
+        lines.push_back(_line);
+    }
+    return std::move(lines);
+}
+
+}  // namespace detail
+
+// ---------------- TOML Config file ----------- BEGIN //
+
+using toml_value = toml::basic_value<toml::preserve_comments>;
+
+// Convert current set of command line arguments to TOML config file
+template <typename T>
+inline std::string ConfigTOML<T>::to_config(
+    const CLI::App *app,     // Current CLI app
+    bool default_also,       // Boolean: output also default values of CLI::ConfigItems
+    bool write_description,  // Boolean: include descriptions of CLI::COnfigItems as comments to TOML file
+    std::string prefix       // Uninitialised (needed to override)
+) const {
+
+    bool is_initialised;  // Boolean: latest parsed TOML value is initialised
+
+    // Defined to reference in lambda definition
+    std::function<toml_value(const CLI::App *, std::string)> get_values;
+
+    // Lambda function to convert CLI items to TOML entries
+    // recursivity used to consider subcommand chains
+    get_values = [&get_values, &is_initialised, default_also, write_description](const CLI::App *app,
+                                                                                 std::string subcom_name) {
+        toml_value j;  // Base for TOML file
+        is_initialised =
+            false;  // Initialisation of boolean to false.
+                    // If false until the end of the function, the currently analysed value is not initialised
+
+        // Loop through all CLI options for the current CLI app
+        for(const CLI::Option *opt : app->get_options({})) {
+            bool missing_entry =
+                false;  // Boolean: if by end of loop iteration still false, current CLI option was not utilised
+            // Only process configurable options
+            if((!opt->get_lnames().empty() || !opt->get_snames().empty()) && opt->get_configurable()) {
+                // Get option long name (if available), otherwise, short name
+                std::string name = (!opt->get_lnames().empty()) ? opt->get_lnames()[0] : opt->get_snames()[0];
+                // Non-flags
+                if(opt->get_type_size() != 0) {
+
+                    // If the option was found on command line
+                    if(opt->count() == 1)
+                        j[name] = opt->results().at(0);
+                    else if(opt->count() > 1) {
+                        j[name] = opt->results();
+                    }
+                    // If the option has a default and is requested by optional argument
+                    else if(default_also && !opt->get_default_str().empty()) {
+                        std::string default_str = opt->get_default_str();
+                        int n_res;
+                        std::vector<std::string> default_vals;
+                        n_res = detail::_split_result_str(std::move(default_str), opt->get_delimiter(), default_vals);
+                        if(default_vals.size() == 1)
+                            j[name] = default_vals[0];
+                        else
+                            j[name] = default_vals;
+
+                    } else if(default_also)
+                        // Leave empty if default is required, but no default value was found
+                        j[name] = "";
+                    else
+                        // Default not required, missing entry
+                        missing_entry = true;
+
+                    // Flag, one passed
+                } else if(opt->count() == 1) {
+                    j[name] = opt->results();
+
+                    // Flag, multiple passed
+                } else if(opt->count() > 1) {
+                    j[name] = opt->count();
+
+                    // Flag, not present
+                } else if(opt->count() == 0) {
+                    if(default_also)
+                        j[name] = opt->get_default_str();
+                    else
+                        j[name] = false;
+                } else
+                    missing_entry = true;
+
+                if(write_description && !missing_entry) {
+                    // Write description if entry not missing
+                    std::vector<std::string> comment = detail::get_description_for_TOML(opt);
+                    j[name].comments() = comment;
+                }
+            }
+        }
+        // Run recursively through subcommands of CLI app
+        for(const CLI::App *subcom : app->get_subcommands({})) {
+            toml_value _temp_toml = get_values(subcom, subcom->get_name());
+            if(is_initialised)
+                j[subcom->get_name()] = _temp_toml;
+        }
+
+        if(!j.is_uninitialized())
+            // Check that j is initialised
+            is_initialised = true;
+
+        if(write_description) {
+            // Write description for main app
+            std::vector<std::string> comment = detail::get_description_for_TOML(app);
+            j.comments() = comment;
+        }
+
+        // Return TOML value
+        return j;
+    };
+
+    // Get values and comments for main app, and recuvsively for subcommands
+    toml_value config_toml = get_values(app, "");
+
+    // Cast toml file into stringstream to return string
+    std::stringstream config_stream;
+
+    try {
+        // If any TOML value is config_toml is uninitialised, this will fail. Caught by exception
+        config_stream << config_toml;
+
+    } catch(const std::exception &e) {
+        std::string error_msg = "No configuration present to save to TOML file.\n"
+                                "Try either running with default_also==TRUE\n"
+                                "or with some command line arguments.\n"
+                                "TOML configuration file will be empty.";
+        throw CLI::ParseError(error_msg, CLI::ExitCodes::ConversionError);
+    }
+
+    // Cast stringstream to string
+    std::string _temp, config_string;
+    while(getline(config_stream, _temp)) {
+        config_string.append(_temp);
+        config_string.push_back('\n');
+    }
+
+    // Return TOML config file as string
+    return config_string;
+}
+template <typename T>
+template <typename toml_type>
+toml_type ConfigTOML<T>::dump_toml_value(const CLI::Option &opt) const {
+
+};
+
+// Convert TOML config file to current set of Command Line Arguments (overridden by user input command line args)
+template <typename T> inline std::vector<CLI::ConfigItem> ConfigTOML<T>::from_config(std::istream &input) const {
+    // Use TOML11 parser to parse TOML configuration file and store it in a toml::basic_value instance
+    toml_value config_file = toml::parse(input);
+
+    // Convert toml_value to std::vector<CLI::ConfigItem>
+    return _from_config(config_file);
+}
+
+using time_point = std::chrono::system_clock::time_point;
+
+// Convert toml_value to std::vector<CLI::ConfigItem>
+template <typename T>
+inline std::vector<CLI::ConfigItem>
+ConfigTOML<T>::_from_config(toml_value j, std::string name, std::vector<std::string> prefix) const {
+
+    // Vector to return
+    std::vector<CLI::ConfigItem> results;
+
+    // Cast toml_value to table (Whole TOML config is a TOML table)
+    // This function will be recursively used on subtables of j
+    auto table = j.as_table();
+
+    // Loop through entries of table
+    for(auto element : table) {
+        auto key = element.first;     // grab key of key-value pari
+        auto value = element.second;  // grab value of key-value pari
+
+        if(value.is_uninitialized()) {
+            continue;
+        } else if(value.is_table()) {
+            // if value is a table, recursively apply _from_config() to it, appending key to list of parent CLI commands
+            prefix.push_back(key);
+            auto sub_results = _from_config(value, key, prefix);
+            results.insert(results.end(), sub_results.begin(), sub_results.end());
+            prefix.pop_back();
+        } else {
+            results.emplace_back();      // Create instance of CLI::ConfigItem
+            auto &res = results.back();  // Get reference to such instance
+            res.name = key;              // Assign name to instance
+            res.parents = prefix;        // Assign list of parents to instance
+
+            std::stringstream ss;  // Declare stringstream to use in switch statement
+
+            // Determine type of toml value and convert to string
+            switch(value.type()) {
+            case toml::value_t::boolean: {
+                auto cast_value = toml::get<bool>(value);
+                res.inputs = {std::to_string(cast_value)};
+                break;
+            }
+            case toml::value_t::string: {
+                auto cast_value = toml::get<std::string>(value);
+                res.inputs = {cast_value};
+                break;
+            }
+            case toml::value_t::integer: {
+                auto cast_value = toml::get<int>(value);
+                res.inputs = {std::to_string(cast_value)};
+                break;
+            }
+            case toml::value_t::floating: {
+                auto cast_value = toml::get<double>(value);
+                res.inputs = {std::to_string(cast_value)};
+                break;
+            }
+            case toml::value_t::local_datetime: 
+            case toml::value_t::local_date: 
+            case toml::value_t::local_time: 
+            case toml::value_t::offset_datetime: {
+                ss << value;
+                res.inputs = {ss.str()};
+                break;
+            }
+            case toml::value_t::array:
+                res.inputs = parse_toml_array(value.as_array(), key);
+                break;
+
+            default:
+                std::stringstream ss_error;
+                ss_error << "Could not convert the key-value pair \"" << key << "\" from any known TOML type.";
+                throw CLI::ParseError(ss_error.str(), CLI::ExitCodes::ConversionError);
+                break;
+            }
+        }
+    }
+
+    return results;
+}
+
+template <typename T>
+inline std::vector<std::string> ConfigTOML<T>::parse_toml_array(toml::value array, const std::string &key) const {
+    std::vector<std::string> array_str;
+    for(auto value : array.as_array()) {
+        if(value.is_table()) {
+            std::stringstream ss_error;
+            ss_error << "TOML arrays of tables are not supported for conversion to ConfigItem";
+            throw CLI::ParseError(ss_error.str(), CLI::ExitCodes::ConversionError);
+        } else {
+            std::stringstream ss;  // Declare stringstream to use in switch statement
+
+            // Determine type of toml value and convert to string
+            switch(value.type()) {
+             case toml::value_t::boolean: {
+                auto cast_value = toml::get<bool>(value);
+                array_str.push_back(std::to_string(cast_value));
+                break;
+            }
+            case toml::value_t::string: {
+                auto cast_value = toml::get<std::string>(value);
+                array_str.push_back(cast_value);
+                break;
+            }
+            case toml::value_t::integer: {
+                auto cast_value = toml::get<int>(value);
+                array_str.push_back(std::to_string(cast_value));
+                break;
+            }
+            case toml::value_t::floating: {
+                auto cast_value = toml::get<double>(value);
+                array_str.push_back(std::to_string(cast_value));
+                break;
+            }
+            case toml::value_t::local_datetime: 
+            case toml::value_t::local_date: 
+            case toml::value_t::local_time: 
+            case toml::value_t::offset_datetime: {
+                ss << value;
+                array_str.push_back(ss.str());
+                break;
+            }
+            case toml::value_t::array: {
+                std::vector<std::string> res_vector = parse_toml_array(value.as_array(), key);
+                array_str.insert(array_str.end(), res_vector.begin(), res_vector.end());
+                break;
+            }
+
+            default:
+                std::stringstream ss_error;
+                ss_error << "Could not convert an element of the array \"" << key << "\" from any known TOML type.";
+                throw CLI::ParseError(ss_error.str(), CLI::ExitCodes::ConversionError);
+                break;
+            }
+        }
+    }
+
+    return array_str;
+}
+// ---------------- TOML Config file ----------- END //
+
+// [CLI11:config_toml_hpp:end]
+}  // namespace CLI
@@ -0,0 +1,195 @@
+// Copyright (c) 2017-2021, University of Cincinnati, developed by Henry Schreiner
+// under NSF AWARD 1414736 and by the respective contributors.
+// All rights reserved.
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+// Include this header in exactly one source file of a program to count the allocations of each thread, available
+// from CLI::allocations() and in the report of App::profile. It replaces every global operator new and operator
+// delete, including the array, nothrow and (with C++17) aligned forms. Memory obtained directly from malloc, such as
+// by C libraries, is not counted.
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#if defined(__cpp_aligned_new) && __cpp_aligned_new >= 201606L && defined(_WIN32)
+#include <malloc.h>
+#endif
+
+#include "App.hpp"
+
+namespace CLI {
+namespace detail {
+
+namespace {
+/// Mark the allocations as counted before main runs
+const bool allocation_counting_enabled = (allocations_counted() = true);
+}  // namespace
+
+/// Allocate and count memory for operator new, calling the new_handler until malloc succeeds; returns nullptr if
+/// there is no new_handler
+inline void *counted_malloc(std::size_t size) {
+    AllocationCount &counter = thread_allocations();
+    ++counter.count;
+    counter.bytes += size;
+    if(size == 0) {
+        size = 1;
+    }
+    while(true) {
+        void *memory = std::malloc(size);
+        if(memory != nullptr) {
+            return memory;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if(handler == nullptr) {
+            return nullptr;
+        }
+        handler();
+    }
+}
+
+#if defined(__cpp_aligned_new) && __cpp_aligned_new >= 201606L
+/// Allocate and count memory for the aligned operator new, see counted_malloc
+inline void *counted_aligned_malloc(std::size_t size, std::size_t alignment) {
+    AllocationCount &counter = thread_allocations();
+    ++counter.count;
+    counter.bytes += size;
+    if(size == 0) {
+        size = 1;
+    }
+    if(alignment < sizeof(void *)) {
+        alignment = sizeof(void *);
+    }
+    while(true) {
+#ifdef _WIN32
+        void *memory = _aligned_malloc(size, alignment);
+#else
+        void *memory{nullptr};
+        if(posix_memalign(&memory, alignment, size) != 0) {
+            memory = nullptr;
+        }
+#endif
+        if(memory != nullptr) {
+            return memory;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if(handler == nullptr) {
+            return nullptr;
+        }
+        handler();
+    }
+}
+
+/// Release memory from counted_aligned_malloc
+inline void counted_aligned_free(void *memory) {
+#ifdef _WIN32
+    _aligned_free(memory);
+#else
+    std::free(memory);
+#endif
+}
+#endif
+
+}  // namespace detail
+}  // namespace CLI
+
+// inlining free into callers of the builtin operator new makes GCC warn about a mismatched deallocation
+#if defined(__GNUC__)
+#define CLI11_ALLOCATION_NOINLINE __attribute__((noinline))
+#else
+#define CLI11_ALLOCATION_NOINLINE
+#endif
+
+CLI11_ALLOCATION_NOINLINE void *operator new(std::size_t size) {
+    void *memory = CLI::detail::counted_malloc(size);
+    if(memory == nullptr) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+CLI11_ALLOCATION_NOINLINE void *operator new[](std::size_t size) { return ::operator new(size); }
+
+CLI11_ALLOCATION_NOINLINE void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+    try {
+        return CLI::detail::counted_malloc(size);
+    } catch(...) {
+        // a new_handler may throw bad_alloc
+        return nullptr;
+    }
+}
+
+CLI11_ALLOCATION_NOINLINE void *operator new[](std::size_t size, const std::nothrow_t &tag) noexcept {
+    return ::operator new(size, tag);
+}
+
+CLI11_ALLOCATION_NOINLINE void operator delete(void *memory) noexcept { std::free(memory); }
+
+CLI11_ALLOCATION_NOINLINE void operator delete[](void *memory) noexcept { std::free(memory); }
+
+CLI11_ALLOCATION_NOINLINE void operator delete(void *memory, const std::nothrow_t &) noexcept { std::free(memory); }
+
+CLI11_ALLOCATION_NOINLINE void operator delete[](void *memory, const std::nothrow_t &) noexcept { std::free(memory); }
+
+#if defined(__cpp_sized_deallocation) && __cpp_sized_deallocation >= 201309L
+CLI11_ALLOCATION_NOINLINE void operator delete(void *memory, std::size_t) noexcept { std::free(memory); }
+
+CLI11_ALLOCATION_NOINLINE void operator delete[](void *memory, std::size_t) noexcept { std::free(memory); }
+#endif
+
+#if defined(__cpp_aligned_new) && __cpp_aligned_new >= 201606L
+CLI11_ALLOCATION_NOINLINE void *operator new(std::size_t size, std::align_val_t alignment) {
+    void *memory = CLI::detail::counted_aligned_malloc(size, static_cast<std::size_t>(alignment));
+    if(memory == nullptr) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+CLI11_ALLOCATION_NOINLINE void *operator new[](std::size_t size, std::align_val_t alignment) {
+    return ::operator new(size, alignment);
+}
+
+CLI11_ALLOCATION_NOINLINE void *
+operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+    try {
+        return CLI::detail::counted_aligned_malloc(size, static_cast<std::size_t>(alignment));
+    } catch(...) {
+        return nullptr;
+    }
+}
+
+CLI11_ALLOCATION_NOINLINE void *
+operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t &tag) noexcept {
+    return ::operator new(size, alignment, tag);
+}
+
+CLI11_ALLOCATION_NOINLINE void operator delete(void *memory, std::align_val_t) noexcept {
+    CLI::detail::counted_aligned_free(memory);
+}
+
+CLI11_ALLOCATION_NOINLINE void operator delete[](void *memory, std::align_val_t) noexcept {
+    CLI::detail::counted_aligned_free(memory);
+}
+
+CLI11_ALLOCATION_NOINLINE void operator delete(void *memory, std::align_val_t, const std::nothrow_t &) noexcept {
+    CLI::detail::counted_aligned_free(memory);
+}
+
+CLI11_ALLOCATION_NOINLINE void operator delete[](void *memory, std::align_val_t, const std::nothrow_t &) noexcept {
+    CLI::detail::counted_aligned_free(memory);
+}
+
+CLI11_ALLOCATION_NOINLINE void operator delete(void *memory, std::size_t, std::align_val_t) noexcept {
+    CLI::detail::counted_aligned_free(memory);
+}
+
+CLI11_ALLOCATION_NOINLINE void operator delete[](void *memory, std::size_t, std::align_val_t) noexcept {
+    CLI::detail::counted_aligned_free(memory);
+}
+#endif
+
+#undef CLI11_ALLOCATION_NOINLINE
@@ -55,6 +55,7 @@ enum class ExitCodes {
     HorribleError,
     OptionNotFound,
     ArgumentMismatch,
+    LimitError,
     BaseClass = 127
 };
 
@@ -165,6 +166,12 @@ class CallForHelp : public Success {
     CallForHelp() : CallForHelp("This should be caught in your main function, see examples", ExitCodes::Success) {}
 };
 
+/// Something like --help=term on command line, the message is the term to search the help for
+class CallForHelpSearch : public Success {
+    CLI11_ERROR_DEF(Success, CallForHelpSearch)
+    explicit CallForHelpSearch(std::string term) : CallForHelpSearch(std::move(term), ExitCodes::Success) {}
+};
+
 /// Usually something like --help-all on command line
 class CallForAllHelp : public Success {
     CLI11_ERROR_DEF(Success, CallForAllHelp)
@@ -279,6 +286,24 @@ class ArgumentMismatch : public ParseError {
     }
 };
 
+/// Thrown when the input exceeds one of the ParseLimits of an App
+class LimitError : public ParseError {
+    CLI11_ERROR_DEF(ParseError, LimitError)
+    CLI11_ERROR_SIMPLE(LimitError)
+    static LimitError Tokens(std::size_t limit) {
+        return LimitError("More than " + std::to_string(limit) + " arguments were given");
+    }
+    static LimitError Bytes(std::size_t limit) {
+        return LimitError("The arguments are longer than " + std::to_string(limit) + " bytes");
+    }
+    static LimitError Values(std::string name, std::size_t limit) {
+        return LimitError(name + ": more than " + std::to_string(limit) + " values were given");
+    }
+    static LimitError Depth(std::string name, std::size_t limit) {
+        return LimitError(name + ": nested deeper than " + std::to_string(limit) + " levels");
+    }
+};
+
 /// Thrown when a requires option is missing
 class RequiresError : public ParseError {
     CLI11_ERROR_DEF(ParseError, RequiresError)
@@ -7,7 +7,9 @@
 #pragma once
 
 // [CLI11:public_includes:set]
+#include <cstddef>
 #include <map>
+#include <ostream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -32,6 +34,21 @@ enum class AppFormatMode {
     Sub,     ///< Used when printed as part of expanded subcommand
 };
 
+/// An option or subcommand found by App::help_search
+struct HelpMatch {
+    /// The App whose help lists the entry, the searched App or one of its named subcommands
+    const App *app{nullptr};
+
+    /// The matching option, or nullptr if a subcommand matched
+    const Option *option{nullptr};
+
+    /// The matching subcommand of app, or nullptr if an option matched
+    const App *subcommand{nullptr};
+
+    /// The help group the entry is listed under
+    std::string group{};
+};
+
 /// This is the minimum requirements to run a formatter.
 ///
 /// A user can subclass this is if they do not care at all
@@ -63,15 +80,31 @@ class FormatterBase {
     /// This is the key method that puts together help
     virtual std::string make_help(const App *, std::string, AppFormatMode) const = 0;
 
+    /// Write the help to a stream; by default this writes the result of make_help
+    virtual void write_help(std::ostream &out, const App *app, std::string name, AppFormatMode mode) const {
+        out << make_help(app, std::move(name), mode);
+    }
+
+    /// Help for only the entries that matched a search for term, see App::help_search; by default each one is
+    /// listed by name with its description
+    virtual std::string
+    make_search(const App *app, std::string name, const std::string &term, const std::vector<HelpMatch> &matches) const;
+
     ///@}
     /// @name Setters
     ///@{
 
     /// Set the "REQUIRED" label
-    void label(std::string key, std::string val) { labels_[key] = val; }
+    void label(std::string key, std::string val) {
+        labels_[key] = val;
+        detail::help_changed();
+    }
 
     /// Set the column width
-    void column_width(std::size_t val) { column_width_ = val; }
+    void column_width(std::size_t val) {
+        column_width_ = val;
+        detail::help_changed();
+    }
 
     ///@}
     /// @name Getters
@@ -113,6 +146,10 @@ class FormatterLambda final : public FormatterBase {
 
 /// This is the default Formatter for CLI11. It pretty prints help output, and is broken into quite a few
 /// overridable methods, to be highly customizable with minimal effort.
+///
+/// Each part of the help is written to a stream once, by the protected _write_* methods. The make_* overridables
+/// return that text as a string, and the write_* overridables write make_* to the stream, so overriding either
+/// form of a part changes the help.
 class Formatter : public FormatterBase {
   public:
     Formatter() = default;
@@ -153,15 +190,52 @@ class Formatter : public FormatterBase {
     /// This puts everything together
     std::string make_help(const App * /*app*/, std::string, AppFormatMode) const override;
 
+    /// This prints the usage line and the matches of a help search, grouped as in the full help
+    std::string make_search(const App *app,
+                            std::string name,
+                            const std::string &term,
+                            const std::vector<HelpMatch> &matches) const override;
+
+    /// This writes a group of options with title, by default make_group
+    virtual void write_group(std::ostream &out,
+                             const std::string &group,
+                             bool is_positional,
+                             const std::vector<const Option *> &opts) const {
+        out << make_group(group, is_positional, opts);
+    }
+
+    /// This writes just the positionals "group", by default make_positionals
+    virtual void write_positionals(std::ostream &out, const App *app) const { out << make_positionals(app); }
+
+    /// This writes all the groups of options, by default make_groups
+    virtual void write_groups(std::ostream &out, const App *app, AppFormatMode mode) const {
+        out << make_groups(app, mode);
+    }
+
+    /// This writes all the subcommands, by default make_subcommands
+    virtual void write_subcommands(std::ostream &out, const App *app, AppFormatMode mode) const {
+        out << make_subcommands(app, mode);
+    }
+
+    /// This writes a subcommand, by default make_subcommand
+    virtual void write_subcommand(std::ostream &out, const App *sub) const { out << make_subcommand(sub); }
+
+    /// This writes a subcommand in help-all, by default make_expanded
+    virtual void write_expanded(std::ostream &out, const App *sub) const { out << make_expanded(sub); }
+
+    /// This writes an option help line, by default make_option
+    virtual void write_option(std::ostream &out, const Option *opt, bool is_positional) const {
+        out << make_option(opt, is_positional);
+    }
+
     ///@}
     /// @name Options
     ///@{
 
     /// This prints out an option help line, either positional or optional form
     virtual std::string make_option(const Option *opt, bool is_positional) const {
-        std::stringstream out;
-        detail::format_help(
-            out, make_option_name(opt, is_positional) + make_option_opts(opt), make_option_desc(opt), column_width_);
+        std::ostringstream out;
+        _write_option(out, opt, is_positional);
         return out.str();
     }
 
@@ -177,6 +251,90 @@ class Formatter : public FormatterBase {
     /// @brief This is used to print the name on the USAGE line
     virtual std::string make_option_usage(const Option *opt) const;
 
+    ///@}
+
+  protected:
+    /// @name Writers
+    ///@{
+
+    /// Write the whole help, the parts through the write_* overridables
+    void _write_help(std::ostream &out, const App *app, const std::string &name, AppFormatMode mode) const;
+
+    /// Write a group of options with title, each option through write_option
+    void _write_group(std::ostream &out,
+                      const std::string &group,
+                      bool is_positional,
+                      const std::vector<const Option *> &opts) const;
+
+    /// Write the positionals "group" through write_group
+    void _write_positionals(std::ostream &out, const App *app) const;
+
+    /// Write all the groups of options through write_group, bucketing the options by group in one pass
+    void _write_groups(std::ostream &out, const App *app, AppFormatMode mode) const;
+
+    /// Write all the subcommands by group through write_subcommand, or their help in help-all
+    void _write_subcommands(std::ostream &out, const App *app, AppFormatMode mode) const;
+
+    /// Write a subcommand line
+    void _write_subcommand(std::ostream &out, const App *sub) const;
+
+    /// Write a subcommand in help-all, indented as a whole
+    void _write_expanded(std::ostream &out, const App *sub) const;
+
+    /// Write an option help line from make_option_name, make_option_opts and make_option_desc
+    void _write_option(std::ostream &out, const Option *opt, bool is_positional) const;
+
+    ///@}
+};
+
+/// A Formatter that writes help straight to a stream. Its write_* methods write each part directly instead of
+/// through the make_* overridables, so the parts are never built as separate strings and joined.
+///
+/// The output is the same as Formatter. The option overridables (make_option_name, make_option_opts,
+/// make_option_desc, make_option_usage), make_usage, make_description and make_footer are still used; the
+/// group and subcommand parts are customized through the write_* methods.
+class StreamFormatter : public Formatter {
+  public:
+    StreamFormatter() = default;
+    StreamFormatter(const StreamFormatter &) = default;
+    StreamFormatter(StreamFormatter &&) = default;
+
+    /// Renders through write_help
+    std::string make_help(const App *app, std::string name, AppFormatMode mode) const override;
+
+    /// This puts everything together
+    void write_help(std::ostream &out, const App *app, std::string name, AppFormatMode mode) const override {
+        _write_help(out, app, name, mode);
+    }
+
+    /// @name Overridables
+    ///@{
+
+    void write_group(std::ostream &out,
+                     const std::string &group,
+                     bool is_positional,
+                     const std::vector<const Option *> &opts) const override {
+        _write_group(out, group, is_positional, opts);
+    }
+
+    void write_positionals(std::ostream &out, const App *app) const override { _write_positionals(out, app); }
+
+    void write_groups(std::ostream &out, const App *app, AppFormatMode mode) const override {
+        _write_groups(out, app, mode);
+    }
+
+    void write_subcommands(std::ostream &out, const App *app, AppFormatMode mode) const override {
+        _write_subcommands(out, app, mode);
+    }
+
+    void write_subcommand(std::ostream &out, const App *sub) const override { _write_subcommand(out, sub); }
+
+    void write_expanded(std::ostream &out, const App *sub) const override { _write_expanded(out, sub); }
+
+    void write_option(std::ostream &out, const Option *opt, bool is_positional) const override {
+        _write_option(out, opt, is_positional);
+    }
+
     ///@}
 };
 
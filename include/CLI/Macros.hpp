@@ -41,4 +41,12 @@
 #define CLI11_DEPRECATED(reason) __attribute__((deprecated(reason)))
 #endif
 
+// Out-of-line definitions in impl/ are marked CLI11_INLINE; they are inline in header-only mode and compiled once
+// into the precompiled library (src/Precompile.cpp) when CLI11_COMPILE is defined
+#ifdef CLI11_COMPILE
+#define CLI11_INLINE
+#else
+#define CLI11_INLINE inline
+#endif
+
 // [CLI11:macros_hpp:end]
@@ -10,14 +10,17 @@
 #include <algorithm>
 #include <functional>
 #include <memory>
+#include <new>
 #include <set>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 // [CLI11:public_includes:end]
 
 #include "Error.hpp"
+#include "FormatterFwd.hpp"
 #include "Macros.hpp"
 #include "Split.hpp"
 #include "StringTools.hpp"
@@ -29,6 +32,8 @@ namespace CLI {
 using results_t = std::vector<std::string>;
 /// callback function definition
 using callback_t = std::function<bool(const results_t &)>;
+/// callback function definition for a callback that may move strings out of the results
+using move_callback_t = std::function<bool(results_t &)>;
 
 class Option;
 class App;
@@ -98,12 +103,14 @@ template <typename CRTP> class OptionBase {
             throw IncorrectConstruction("Group names may not contain newlines or null characters");
         }
         group_ = name;
+        detail::help_changed();
         return static_cast<CRTP *>(this);
     }
 
     /// Set the option as required
     CRTP *required(bool value = true) {
         required_ = value;
+        detail::help_changed();
         return static_cast<CRTP *>(this);
     }
 
@@ -270,6 +277,9 @@ class Option : public OptionBase<Option> {
     /// A human readable default value, either manually set, captured, or captured by default
     std::string default_str_{};
 
+    /// True if the default string is generated from default_snapshot_ rather than stored in default_str_
+    bool default_str_pending_{false};
+
     /// If given, replace the text that describes the option type and usage in the help text
     std::string option_text_{};
 
@@ -281,6 +291,13 @@ class Option : public OptionBase<Option> {
     /// Run this function to capture a default (ignore if empty)
     std::function<std::string()> default_function_{};
 
+    /// Copy the current value and return a function that converts the copy to a string, set by App so the string
+    /// conversion for a captured default can be deferred
+    std::function<std::function<std::string()>()> default_capture_{};
+
+    /// Converts the value copied by the last deferred capture to a string
+    std::function<std::string()> default_snapshot_{};
+
     ///@}
     /// @name Configuration
     ///@{
@@ -315,14 +332,37 @@ class Option : public OptionBase<Option> {
     /// Options store a callback to do all the work
     callback_t callback_{};
 
+    /// Callback that moves the results into the bound variable, set by App for string targets
+    move_callback_t move_callback_{};
+
     ///@}
     /// @name Parsing results
     ///@{
 
     /// complete Results of parsing
     results_t results_{};
+    /// number of trailing flag occurrences held as a count instead of as strings in results_ while parsing
+    std::size_t flag_count_{0};
+    /// the value shared by the counted flag occurrences
+    std::string flag_value_{};
+    /// the callback sums the flag values, so counted occurrences can be reduced to their total
+    bool sum_flags_{false};
+    /// the total of summed flags, given to the callback instead of every occurrence
+    results_t flag_sum_{};
+    /// number of results discarded while parsing because the TakeLast or TakeFirst policy would never use them
+    std::size_t dropped_results_{0};
     /// results after reduction
     results_t proc_results_{};
+    /// the value the callback converted for the bound variable, copied by results(T&) and as<T>() of the same type
+    std::shared_ptr<void> typed_result_{};
+    /// inline storage used instead of typed_result_ for scalars, so caching them never allocates
+    std::aligned_storage<sizeof(long double), alignof(long double)>::type typed_result_local_{};
+    /// detail::type_key of the type stored in typed_result_ or typed_result_local_
+    const void *typed_result_type_{nullptr};
+    /// true if the stored value is the conversion of the current results
+    bool typed_result_valid_{false};
+    /// copy the bound variable into typed_result_ after a successful callback, set by App
+    std::function<void(Option &)> typed_result_store_{};
     /// enumeration for the option state machine
     enum class option_state : char {
         parsing = 0,       //!< The option is currently collecting parsed results
@@ -340,6 +380,8 @@ class Option : public OptionBase<Option> {
     bool run_callback_for_default_{false};
     /// flag indicating a separator needs to be injected after each argument call
     bool inject_separator_{false};
+    /// flag indicating the results may be moved into the bound variable when the callback runs
+    bool move_results_{false};
     ///@}
 
     /// Making an option by hand is not defined, it must be made by the App class
@@ -356,164 +398,74 @@ class Option : public OptionBase<Option> {
     Option &operator=(const Option &) = delete;
 
     /// Count the total number of times an option was passed
-    std::size_t count() const { return results_.size(); }
+    std::size_t count() const { return results_.size() + flag_count_ + dropped_results_; }
 
     /// True if the option was not passed
-    bool empty() const { return results_.empty(); }
+    bool empty() const { return count() == 0; }
 
     /// This class is true if option is passed.
     explicit operator bool() const { return !empty(); }
 
     /// Clear the parsed results (mostly for testing)
-    void clear() {
-        results_.clear();
-        current_option_state_ = option_state::parsing;
-    }
+    void clear();
 
     ///@}
     /// @name Setting options
     ///@{
 
     /// Set the number of expected arguments
-    Option *expected(int value) {
-        if(value < 0) {
-            expected_min_ = -value;
-            if(expected_max_ < expected_min_) {
-                expected_max_ = expected_min_;
-            }
-            allow_extra_args_ = true;
-            flag_like_ = false;
-        } else if(value == detail::expected_max_vector_size) {
-            expected_min_ = 1;
-            expected_max_ = detail::expected_max_vector_size;
-            allow_extra_args_ = true;
-            flag_like_ = false;
-        } else {
-            expected_min_ = value;
-            expected_max_ = value;
-            flag_like_ = (expected_min_ == 0);
-        }
-        return this;
-    }
+    Option *expected(int value);
 
     /// Set the range of expected arguments
-    Option *expected(int value_min, int value_max) {
-        if(value_min < 0) {
-            value_min = -value_min;
-        }
-
-        if(value_max < 0) {
-            value_max = detail::expected_max_vector_size;
-        }
-        if(value_max < value_min) {
-            expected_min_ = value_max;
-            expected_max_ = value_min;
-        } else {
-            expected_max_ = value_max;
-            expected_min_ = value_min;
-        }
-
-        return this;
-    }
+    Option *expected(int value_min, int value_max);
     /// Set the value of allow_extra_args which allows extra value arguments on the flag or option to be included
     /// with each instance
-    Option *allow_extra_args(bool value = true) {
-        allow_extra_args_ = value;
-        return this;
-    }
+    Option *allow_extra_args(bool value = true);
     /// Get the current value of allow extra args
     bool get_allow_extra_args() const { return allow_extra_args_; }
 
     /// Set the value of run_callback_for_default which controls whether the callback function should be called to set
     /// the default This is controlled automatically but could be manipulated by the user.
-    Option *run_callback_for_default(bool value = true) {
-        run_callback_for_default_ = value;
-        return this;
-    }
+    Option *run_callback_for_default(bool value = true);
     /// Get the current value of run_callback_for_default
     bool get_run_callback_for_default() const { return run_callback_for_default_; }
 
+    /// Move the results into the bound variable instead of copying them when the callback runs. Only options bound to
+    /// a std::string or std::vector<std::string> are affected; afterwards count() is unchanged but results() holds
+    /// empty strings.
+    Option *move_results(bool value = true);
+    /// Get the current value of move_results
+    bool get_move_results() const { return move_results_; }
+
     /// Adds a Validator with a built in type name
-    Option *check(Validator validator, const std::string &validator_name = "") {
-        validator.non_modifying();
-        validators_.push_back(std::move(validator));
-        if(!validator_name.empty())
-            validators_.back().name(validator_name);
-        return this;
-    }
+    Option *check(Validator validator, const std::string &validator_name = "");
 
     /// Adds a Validator. Takes a const string& and returns an error message (empty if conversion/check is okay).
     Option *check(std::function<std::string(const std::string &)> Validator,
                   std::string Validator_description = "",
-                  std::string Validator_name = "") {
-        validators_.emplace_back(Validator, std::move(Validator_description), std::move(Validator_name));
-        validators_.back().non_modifying();
-        return this;
-    }
+                  std::string Validator_name = "");
 
     /// Adds a transforming Validator with a built in type name
-    Option *transform(Validator Validator, const std::string &Validator_name = "") {
-        validators_.insert(validators_.begin(), std::move(Validator));
-        if(!Validator_name.empty())
-            validators_.front().name(Validator_name);
-        return this;
-    }
+    Option *transform(Validator Validator, const std::string &Validator_name = "");
 
     /// Adds a Validator-like function that can change result
     Option *transform(const std::function<std::string(std::string)> &func,
                       std::string transform_description = "",
-                      std::string transform_name = "") {
-        validators_.insert(validators_.begin(),
-                           Validator(
-                               [func](std::string &val) {
-                                   val = func(val);
-                                   return std::string{};
-                               },
-                               std::move(transform_description),
-                               std::move(transform_name)));
-
-        return this;
-    }
+                      std::string transform_name = "");
 
     /// Adds a user supplied function to run on each item passed in (communicate though lambda capture)
-    Option *each(const std::function<void(std::string)> &func) {
-        validators_.emplace_back(
-            [func](std::string &inout) {
-                func(inout);
-                return std::string{};
-            },
-            std::string{});
-        return this;
-    }
+    Option *each(const std::function<void(std::string)> &func);
     /// Get a named Validator
-    Validator *get_validator(const std::string &Validator_name = "") {
-        for(auto &Validator : validators_) {
-            if(Validator_name == Validator.get_name()) {
-                return &Validator;
-            }
-        }
-        if((Validator_name.empty()) && (!validators_.empty())) {
-            return &(validators_.front());
-        }
-        throw OptionNotFound(std::string{"Validator "} + Validator_name + " Not Found");
-    }
+    Validator *get_validator(const std::string &Validator_name = "");
 
     /// Get a Validator by index NOTE: this may not be the order of definition
-    Validator *get_validator(int index) {
-        // This is an signed int so that it is not equivalent to a pointer.
-        if(index >= 0 && index < static_cast<int>(validators_.size())) {
-            return &(validators_[static_cast<decltype(validators_)::size_type>(index)]);
-        }
-        throw OptionNotFound("Validator index is not valid");
-    }
+    Validator *get_validator(int index);
+
+    /// Get the Validators and transforms, in the order they run
+    const std::vector<Validator> &get_validators() const { return validators_; }
 
     /// Sets required options
-    Option *needs(Option *opt) {
-        if(opt != this) {
-            needs_.insert(opt);
-        }
-        return this;
-    }
+    Option *needs(Option *opt);
 
     /// Can find a string if needed
     template <typename T = App> Option *needs(std::string opt_name) {
@@ -531,31 +483,10 @@ class Option : public OptionBase<Option> {
     }
 
     /// Remove needs link from an option. Returns true if the option really was in the needs list.
-    bool remove_needs(Option *opt) {
-        auto iterator = std::find(std::begin(needs_), std::end(needs_), opt);
-
-        if(iterator == std::end(needs_)) {
-            return false;
-        }
-        needs_.erase(iterator);
-        return true;
-    }
+    bool remove_needs(Option *opt);
 
     /// Sets excluded options
-    Option *excludes(Option *opt) {
-        if(opt == this) {
-            throw(IncorrectConstruction("and option cannot exclude itself"));
-        }
-        excludes_.insert(opt);
-
-        // Help text should be symmetric - excluding a should exclude b
-        opt->excludes_.insert(this);
-
-        // Ignoring the insert return value, excluding twice is now allowed.
-        // (Mostly to allow both directions to be excluded by user, even though the library does it for you.)
-
-        return this;
-    }
+    Option *excludes(Option *opt);
 
     /// Can find a string if needed
     template <typename T = App> Option *excludes(std::string opt_name) {
@@ -573,21 +504,10 @@ class Option : public OptionBase<Option> {
     }
 
     /// Remove needs link from an option. Returns true if the option really was in the needs list.
-    bool remove_excludes(Option *opt) {
-        auto iterator = std::find(std::begin(excludes_), std::end(excludes_), opt);
-
-        if(iterator == std::end(excludes_)) {
-            return false;
-        }
-        excludes_.erase(iterator);
-        return true;
-    }
+    bool remove_excludes(Option *opt);
 
     /// Sets environment variable to read if no option given
-    Option *envname(std::string name) {
-        envname_ = std::move(name);
-        return this;
-    }
+    Option *envname(std::string name);
 
     /// Ignore case
     ///
@@ -639,24 +559,10 @@ class Option : public OptionBase<Option> {
     }
 
     /// Take the last argument if given multiple times (or another policy)
-    Option *multi_option_policy(MultiOptionPolicy value = MultiOptionPolicy::Throw) {
-        if(value != multi_option_policy_) {
-            if(multi_option_policy_ == MultiOptionPolicy::Throw && expected_max_ == detail::expected_max_vector_size &&
-               expected_min_ > 1) {  // this bizarre condition is to maintain backwards compatibility
-                                     // with the previous behavior of expected_ with vectors
-                expected_max_ = expected_min_;
-            }
-            multi_option_policy_ = value;
-            current_option_state_ = option_state::parsing;
-        }
-        return this;
-    }
+    Option *multi_option_policy(MultiOptionPolicy value = MultiOptionPolicy::Throw);
 
     /// Disable flag overrides values, e.g. --flag=<value> is not allowed
-    Option *disable_flag_override(bool value = true) {
-        disable_flag_override_ = value;
-        return this;
-    }
+    Option *disable_flag_override(bool value = true);
     ///@}
     /// @name Accessors
     ///@{
@@ -682,7 +588,7 @@ class Option : public OptionBase<Option> {
     std::set<Option *> get_excludes() const { return excludes_; }
 
     /// The default value (for help printing)
-    std::string get_default_str() const { return default_str_; }
+    std::string get_default_str() const;
 
     /// Get the callback function
     callback_t get_callback() const { return callback_; }
@@ -696,18 +602,7 @@ class Option : public OptionBase<Option> {
     /// Get the flag names with specified default values
     const std::vector<std::string> &get_fnames() const { return fnames_; }
     /// Get a single name for the option, first of lname, pname, sname, envname
-    const std::string &get_single_name() const {
-        if(!lnames_.empty()) {
-            return lnames_[0];
-        }
-        if(!pname_.empty()) {
-            return pname_;
-        }
-        if(!snames_.empty()) {
-            return snames_[0];
-        }
-        return envname_;
-    }
+    const std::string &get_single_name() const;
     /// The number of times the option expects to be included
     int get_expected() const { return expected_min_; }
 
@@ -720,10 +615,7 @@ class Option : public OptionBase<Option> {
     int get_items_expected_min() const { return type_size_min_ * expected_min_; }
 
     /// Get the maximum number of items expected to be returned and used for the callback
-    int get_items_expected_max() const {
-        int t = type_size_max_;
-        return detail::checked_multiply(t, expected_max_) ? t : detail::expected_max_vector_size;
-    }
+    int get_items_expected_max() const;
     /// The total min number of expected  string values to be used
     int get_items_expected() const { return get_items_expected_min(); }
 
@@ -740,15 +632,9 @@ class Option : public OptionBase<Option> {
     const std::string &get_description() const { return description_; }
 
     /// Set the description
-    Option *description(std::string option_description) {
-        description_ = std::move(option_description);
-        return this;
-    }
+    Option *description(std::string option_description);
 
-    Option *option_text(std::string text) {
-        option_text_ = std::move(text);
-        return this;
-    }
+    Option *option_text(std::string text);
 
     const std::string &get_option_text() const { return option_text_; }
 
@@ -762,262 +648,73 @@ class Option : public OptionBase<Option> {
     /// Use `get_name(true)` to get the positional name (replaces `get_pname`)
     std::string get_name(bool positional = false,  ///< Show the positional name
                          bool all_options = false  ///< Show every option
-                         ) const {
-        if(get_group().empty())
-            return {};  // Hidden
-
-        if(all_options) {
-
-            std::vector<std::string> name_list;
-
-            /// The all list will never include a positional unless asked or that's the only name.
-            if((positional && (!pname_.empty())) || (snames_.empty() && lnames_.empty())) {
-                name_list.push_back(pname_);
-            }
-            if((get_items_expected() == 0) && (!fnames_.empty())) {
-                for(const std::string &sname : snames_) {
-                    name_list.push_back("-" + sname);
-                    if(check_fname(sname)) {
-                        name_list.back() += "{" + get_flag_value(sname, "") + "}";
-                    }
-                }
-
-                for(const std::string &lname : lnames_) {
-                    name_list.push_back("--" + lname);
-                    if(check_fname(lname)) {
-                        name_list.back() += "{" + get_flag_value(lname, "") + "}";
-                    }
-                }
-            } else {
-                for(const std::string &sname : snames_)
-                    name_list.push_back("-" + sname);
-
-                for(const std::string &lname : lnames_)
-                    name_list.push_back("--" + lname);
-            }
-
-            return detail::join(name_list);
-        }
-
-        // This returns the positional name no matter what
-        if(positional)
-            return pname_;
-
-        // Prefer long name
-        if(!lnames_.empty())
-            return std::string(2, '-') + lnames_[0];
-
-        // Or short name if no long name
-        if(!snames_.empty())
-            return std::string(1, '-') + snames_[0];
-
-        // If positional is the only name, it's okay to use that
-        return pname_;
-    }
+                         ) const;
 
     ///@}
     /// @name Parser tools
     ///@{
 
     /// Process the callback
-    void run_callback() {
-
-        if(current_option_state_ == option_state::parsing) {
-            _validate_results(results_);
-            current_option_state_ = option_state::validated;
-        }
-
-        if(current_option_state_ < option_state::reduced) {
-            _reduce_results(proc_results_, results_);
-            current_option_state_ = option_state::reduced;
-        }
-        if(current_option_state_ >= option_state::reduced) {
-            current_option_state_ = option_state::callback_run;
-            if(!(callback_)) {
-                return;
-            }
-            const results_t &send_results = proc_results_.empty() ? results_ : proc_results_;
-            bool local_result = callback_(send_results);
-
-            if(!local_result)
-                throw ConversionError(get_name(), results_);
-        }
-    }
+    void run_callback();
 
     /// If options share any of the same names, find it
-    const std::string &matching_name(const Option &other) const {
-        static const std::string estring;
-        for(const std::string &sname : snames_)
-            if(other.check_sname(sname))
-                return sname;
-        for(const std::string &lname : lnames_)
-            if(other.check_lname(lname))
-                return lname;
-
-        if(ignore_case_ ||
-           ignore_underscore_) {  // We need to do the inverse, in case we are ignore_case or ignore underscore
-            for(const std::string &sname : other.snames_)
-                if(check_sname(sname))
-                    return sname;
-            for(const std::string &lname : other.lnames_)
-                if(check_lname(lname))
-                    return lname;
-        }
-        return estring;
-    }
+    const std::string &matching_name(const Option &other) const;
     /// If options share any of the same names, they are equal (not counting positional)
     bool operator==(const Option &other) const { return !matching_name(other).empty(); }
 
     /// Check a name. Requires "-" or "--" for short / long, supports positional name
-    bool check_name(const std::string &name) const {
-
-        if(name.length() > 2 && name[0] == '-' && name[1] == '-')
-            return check_lname(name.substr(2));
-        if(name.length() > 1 && name.front() == '-')
-            return check_sname(name.substr(1));
-        if(!pname_.empty()) {
-            std::string local_pname = pname_;
-            std::string local_name = name;
-            if(ignore_underscore_) {
-                local_pname = detail::remove_underscore(local_pname);
-                local_name = detail::remove_underscore(local_name);
-            }
-            if(ignore_case_) {
-                local_pname = detail::to_lower(local_pname);
-                local_name = detail::to_lower(local_name);
-            }
-            if(local_name == local_pname) {
-                return true;
-            }
-        }
-
-        if(!envname_.empty()) {
-            // this needs to be the original since envname_ shouldn't match on case insensitivity
-            return (name == envname_);
-        }
-        return false;
-    }
+    bool check_name(const std::string &name) const;
 
     /// Requires "-" to be removed from string
-    bool check_sname(std::string name) const {
-        return (detail::find_member(std::move(name), snames_, ignore_case_) >= 0);
+    bool check_sname(const std::string &name) const {
+        return (detail::find_member(name, snames_, ignore_case_) >= 0);
     }
 
     /// Requires "--" to be removed from string
-    bool check_lname(std::string name) const {
-        return (detail::find_member(std::move(name), lnames_, ignore_case_, ignore_underscore_) >= 0);
+    bool check_lname(const std::string &name) const {
+        return (detail::find_member(name, lnames_, ignore_case_, ignore_underscore_) >= 0);
     }
 
     /// Requires "--" to be removed from string
-    bool check_fname(std::string name) const {
-        if(fnames_.empty()) {
-            return false;
-        }
-        return (detail::find_member(std::move(name), fnames_, ignore_case_, ignore_underscore_) >= 0);
-    }
+    bool check_fname(const std::string &name) const;
 
     /// Get the value that goes for a flag, nominally gets the default value but allows for overrides if not
     /// disabled
-    std::string get_flag_value(const std::string &name, std::string input_value) const {
-        static const std::string trueString{"true"};
-        static const std::string falseString{"false"};
-        static const std::string emptyString{"{}"};
-        // check for disable flag override_
-        if(disable_flag_override_) {
-            if(!((input_value.empty()) || (input_value == emptyString))) {
-                auto default_ind = detail::find_member(name, fnames_, ignore_case_, ignore_underscore_);
-                if(default_ind >= 0) {
-                    // We can static cast this to std::size_t because it is more than 0 in this block
-                    if(default_flag_values_[static_cast<std::size_t>(default_ind)].second != input_value) {
-                        throw(ArgumentMismatch::FlagOverride(name));
-                    }
-                } else {
-                    if(input_value != trueString) {
-                        throw(ArgumentMismatch::FlagOverride(name));
-                    }
-                }
-            }
-        }
-        auto ind = detail::find_member(name, fnames_, ignore_case_, ignore_underscore_);
-        if((input_value.empty()) || (input_value == emptyString)) {
-            if(flag_like_) {
-                return (ind < 0) ? trueString : default_flag_values_[static_cast<std::size_t>(ind)].second;
-            } else {
-                return (ind < 0) ? default_str_ : default_flag_values_[static_cast<std::size_t>(ind)].second;
-            }
-        }
-        if(ind < 0) {
-            return input_value;
-        }
-        if(default_flag_values_[static_cast<std::size_t>(ind)].second == falseString) {
-            try {
-                auto val = detail::to_flag_value(input_value);
-                return (val == 1) ? falseString : (val == (-1) ? trueString : std::to_string(-val));
-            } catch(const std::invalid_argument &) {
-                return input_value;
-            }
-        } else {
-            return input_value;
-        }
-    }
+    std::string get_flag_value(const std::string &name, std::string input_value) const;
 
     /// Puts a result at the end
-    Option *add_result(std::string s) {
-        _add_result(std::move(s), results_);
-        current_option_state_ = option_state::parsing;
-        return this;
-    }
+    Option *add_result(std::string s);
 
     /// Puts a result at the end and get a count of the number of arguments actually added
-    Option *add_result(std::string s, int &results_added) {
-        results_added = _add_result(std::move(s), results_);
-        current_option_state_ = option_state::parsing;
-        return this;
-    }
+    Option *add_result(std::string s, int &results_added);
 
     /// Puts a result at the end
-    Option *add_result(std::vector<std::string> s) {
-        for(auto &str : s) {
-            _add_result(std::move(str), results_);
-        }
-        current_option_state_ = option_state::parsing;
-        return this;
-    }
+    Option *add_result(std::vector<std::string> s);
 
     /// Get the current complete results set
-    const results_t &results() const { return results_; }
+    const results_t &results() const;
 
     /// Get a copy of the results
-    results_t reduced_results() const {
-        results_t res = proc_results_.empty() ? results_ : proc_results_;
-        if(current_option_state_ < option_state::reduced) {
-            if(current_option_state_ == option_state::parsing) {
-                res = results_;
-                _validate_results(res);
-            }
-            if(!res.empty()) {
-                results_t extra;
-                _reduce_results(extra, res);
-                if(!extra.empty()) {
-                    res = std::move(extra);
-                }
-            }
-        }
-        return res;
-    }
+    results_t reduced_results() const;
 
     /// Get the results as a specified type
+    ///
+    /// For options bound to a variable the callback keeps a copy of the converted value, so later calls for the same
+    /// type only copy it. The copy is dropped whenever the results change.
     template <typename T> void results(T &output) const {
         bool retval;
         if(current_option_state_ >= option_state::reduced || (results_.size() == 1 && validators_.empty())) {
+            if(_get_cached_result(output)) {
+                return;
+            }
             const results_t &res = (proc_results_.empty()) ? results_ : proc_results_;
             retval = detail::lexical_conversion<T, T>(res, output);
         } else {
             results_t res;
             if(results_.empty()) {
-                if(!default_str_.empty()) {
-                    // _add_results takes an rvalue only
-                    _add_result(std::string(default_str_), res);
+                std::string default_str = get_default_str();
+                if(!default_str.empty()) {
+                    _add_result(std::move(default_str), res);
                     _validate_results(res);
                     results_t extra;
                     _reduce_results(extra, res);
@@ -1052,90 +749,38 @@ class Option : public OptionBase<Option> {
     ///@{
 
     /// Set the type function to run when displayed on this option
-    Option *type_name_fn(std::function<std::string()> typefun) {
-        type_name_ = std::move(typefun);
-        return this;
-    }
+    Option *type_name_fn(std::function<std::string()> typefun);
 
     /// Set a custom option typestring
-    Option *type_name(std::string typeval) {
-        type_name_fn([typeval]() { return typeval; });
-        return this;
-    }
+    Option *type_name(std::string typeval);
 
     /// Set a custom option size
-    Option *type_size(int option_type_size) {
-        if(option_type_size < 0) {
-            // this section is included for backwards compatibility
-            type_size_max_ = -option_type_size;
-            type_size_min_ = -option_type_size;
-            expected_max_ = detail::expected_max_vector_size;
-        } else {
-            type_size_max_ = option_type_size;
-            if(type_size_max_ < detail::expected_max_vector_size) {
-                type_size_min_ = option_type_size;
-            } else {
-                inject_separator_ = true;
-            }
-            if(type_size_max_ == 0)
-                required_ = false;
-        }
-        return this;
-    }
+    Option *type_size(int option_type_size);
     /// Set a custom option type size range
-    Option *type_size(int option_type_size_min, int option_type_size_max) {
-        if(option_type_size_min < 0 || option_type_size_max < 0) {
-            // this section is included for backwards compatibility
-            expected_max_ = detail::expected_max_vector_size;
-            option_type_size_min = (std::abs)(option_type_size_min);
-            option_type_size_max = (std::abs)(option_type_size_max);
-        }
-
-        if(option_type_size_min > option_type_size_max) {
-            type_size_max_ = option_type_size_min;
-            type_size_min_ = option_type_size_max;
-        } else {
-            type_size_min_ = option_type_size_min;
-            type_size_max_ = option_type_size_max;
-        }
-        if(type_size_max_ == 0) {
-            required_ = false;
-        }
-        if(type_size_max_ >= detail::expected_max_vector_size) {
-            inject_separator_ = true;
-        }
-        return this;
-    }
+    Option *type_size(int option_type_size_min, int option_type_size_max);
 
     /// Set the value of the separator injection flag
     void inject_separator(bool value = true) { inject_separator_ = value; }
 
     /// Set a capture function for the default. Mostly used by App.
-    Option *default_function(const std::function<std::string()> &func) {
-        default_function_ = func;
-        return this;
-    }
+    Option *default_function(const std::function<std::string()> &func);
 
-    /// Capture the default value from the original value (if it can be captured)
-    Option *capture_default_str() {
-        if(default_function_) {
-            default_str_ = default_function_();
-        }
-        return this;
-    }
+    /// Capture the default value from the original value (if it can be captured). For variables bound by App the
+    /// value is copied now but only converted to a string when the default is read.
+    Option *capture_default_str();
 
     /// Set the default value string representation (does not change the contained value)
-    Option *default_str(std::string val) {
-        default_str_ = std::move(val);
-        return this;
-    }
+    Option *default_str(std::string val);
 
     /// Set the default value and validate the results and run the callback if appropriate to set the value into the
     /// bound value only available for types that can be converted to a string
     template <typename X> Option *default_val(const X &val) {
         std::string val_str = detail::to_string(val);
+        default_str_pending_ = false;
         auto old_option_state = current_option_state_;
+        _expand_flag_results();
         results_t old_results{std::move(results_)};
+        auto old_dropped = dropped_results_;
         results_.clear();
         try {
             add_result(val_str);
@@ -1143,184 +788,119 @@ class Option : public OptionBase<Option> {
                 run_callback();  // run callback sets the state we need to reset it again
                 current_option_state_ = option_state::parsing;
             } else {
+                _expand_flag_results();
                 _validate_results(results_);
                 current_option_state_ = old_option_state;
             }
         } catch(const CLI::Error &) {
             // this should be done
             results_ = std::move(old_results);
+            flag_count_ = 0;
+            dropped_results_ = old_dropped;
             current_option_state_ = old_option_state;
             throw;
         }
         results_ = std::move(old_results);
+        flag_count_ = 0;
+        dropped_results_ = old_dropped;
+        typed_result_valid_ = false;
         default_str_ = std::move(val_str);
+        detail::help_changed();
         return this;
     }
 
     /// Get the full typename for this option
-    std::string get_type_name() const {
-        std::string full_type_name = type_name_();
-        if(!validators_.empty()) {
-            for(auto &Validator : validators_) {
-                std::string vtype = Validator.get_description();
-                if(!vtype.empty()) {
-                    full_type_name += ":" + vtype;
-                }
-            }
+    std::string get_type_name() const;
+
+  private:
+    /// Copy the value converted by the callback into output if it has the same type, returns false otherwise
+    template <typename T, enable_if_t<detail::is_cacheable<T>::value, detail::enabler> = detail::dummy>
+    bool _get_cached_result(T &output) const {
+        if(!typed_result_valid_ || typed_result_type_ != detail::type_key<T>()) {
+            return false;
         }
-        return full_type_name;
+        output = *static_cast<const T *>(_typed_result_storage<T>());
+        return true;
     }
 
-  private:
-    /// Run the results through the Validators
-    void _validate_results(results_t &res) const {
-        // Run the Validators (can change the string)
-        if(!validators_.empty()) {
-            if(type_size_max_ > 1) {  // in this context index refers to the index in the type
-                int index = 0;
-                if(get_items_expected_max() < static_cast<int>(res.size()) &&
-                   multi_option_policy_ == CLI::MultiOptionPolicy::TakeLast) {
-                    // create a negative index for the earliest ones
-                    index = get_items_expected_max() - static_cast<int>(res.size());
-                }
+    /// The storage holding a cached value of type T
+    template <typename T, enable_if_t<detail::is_inline_cacheable<T>::value, detail::enabler> = detail::dummy>
+    const void *_typed_result_storage() const {
+        return &typed_result_local_;
+    }
 
-                for(std::string &result : res) {
-                    if(detail::is_separator(result) && type_size_max_ != type_size_min_ && index >= 0) {
-                        index = 0;  // reset index for variable size chunks
-                        continue;
-                    }
-                    auto err_msg = _validate(result, (index >= 0) ? (index % type_size_max_) : index);
-                    if(!err_msg.empty())
-                        throw ValidationError(get_name(), err_msg);
-                    ++index;
-                }
-            } else {
-                int index = 0;
-                if(expected_max_ < static_cast<int>(res.size()) &&
-                   multi_option_policy_ == CLI::MultiOptionPolicy::TakeLast) {
-                    // create a negative index for the earliest ones
-                    index = expected_max_ - static_cast<int>(res.size());
-                }
-                for(std::string &result : res) {
-                    auto err_msg = _validate(result, index);
-                    ++index;
-                    if(!err_msg.empty())
-                        throw ValidationError(get_name(), err_msg);
-                }
-            }
+    /// The storage holding a cached value of type T
+    template <typename T, enable_if_t<!detail::is_inline_cacheable<T>::value, detail::enabler> = detail::dummy>
+    const void *_typed_result_storage() const {
+        return typed_result_.get();
+    }
+
+    /// Types that cannot be copied are converted every time
+    template <typename T, enable_if_t<!detail::is_cacheable<T>::value, detail::enabler> = detail::dummy>
+    bool _get_cached_result(T &) const {
+        return false;
+    }
+
+    /// Store a converted scalar for later calls to results(T&) without allocating
+    template <typename T, enable_if_t<detail::is_inline_cacheable<T>::value, detail::enabler> = detail::dummy>
+    void _store_typed_result(const T &value) {
+        ::new(static_cast<void *>(&typed_result_local_)) T(value);
+        typed_result_type_ = detail::type_key<T>();
+        typed_result_valid_ = true;
+    }
+
+    /// Store the converted value for later calls to results(T&), reusing the storage of the previous parse
+    template <typename T, enable_if_t<!detail::is_inline_cacheable<T>::value, detail::enabler> = detail::dummy>
+    void _store_typed_result(const T &value) {
+        if(typed_result_ && typed_result_type_ == detail::type_key<T>()) {
+            *static_cast<T *>(typed_result_.get()) = value;
+        } else {
+            typed_result_ = std::make_shared<T>(value);
+            typed_result_type_ = detail::type_key<T>();
         }
+        typed_result_valid_ = true;
     }
 
+    /// Store an occurrence of a pure flag as a count, returns false if it must be added to results_ as a string
+    bool _count_flag_result(std::string &value);
+
+    /// Convert the counted flag occurrences into strings at the end of results_
+    void _expand_flag_results();
+
+    /// Reduce counted flag occurrences for TakeLast and TakeFirst without converting each of them,
+    /// returns false if the full results are needed
+    bool _reduce_flag_count();
+
+    /// Total the counted occurrences of a summed flag into flag_sum_ so the callback gets a single value
+    void _sum_flag_count();
+
+    /// End the counting of flag occurrences when parsing is done: reduce them if the policy allows it, then expand
+    /// them so results() holds every occurrence
+    void _finish_flag_count();
+
+    /// Drop results the TakeLast or TakeFirst policy will never use, so repeating an option does not grow the storage
+    /// beyond twice the number of items expected. Options with validators keep everything since the validators see
+    /// every value.
+    void _trim_results();
+
+    /// Run the results through the Validators
+    void _validate_results(results_t &res) const;
+
     /** reduce the results in accordance with the MultiOptionPolicy
     @param[out] res results are assigned to res if there if they are different
     */
-    void _reduce_results(results_t &res, const results_t &original) const {
-
-        // max num items expected or length of vector, always at least 1
-        // Only valid for a trimming policy
-
-        res.clear();
-        // Operation depends on the policy setting
-        switch(multi_option_policy_) {
-        case MultiOptionPolicy::TakeAll:
-            break;
-        case MultiOptionPolicy::TakeLast: {
-            // Allow multi-option sizes (including 0)
-            std::size_t trim_size = std::min<std::size_t>(
-                static_cast<std::size_t>(std::max<int>(get_items_expected_max(), 1)), original.size());
-            if(original.size() != trim_size) {
-                res.assign(original.end() - static_cast<results_t::difference_type>(trim_size), original.end());
-            }
-        } break;
-        case MultiOptionPolicy::TakeFirst: {
-            std::size_t trim_size = std::min<std::size_t>(
-                static_cast<std::size_t>(std::max<int>(get_items_expected_max(), 1)), original.size());
-            if(original.size() != trim_size) {
-                res.assign(original.begin(), original.begin() + static_cast<results_t::difference_type>(trim_size));
-            }
-        } break;
-        case MultiOptionPolicy::Join:
-            if(results_.size() > 1) {
-                res.push_back(detail::join(original, std::string(1, (delimiter_ == '\0') ? '\n' : delimiter_)));
-            }
-            break;
-        case MultiOptionPolicy::Throw:
-        default: {
-            auto num_min = static_cast<std::size_t>(get_items_expected_min());
-            auto num_max = static_cast<std::size_t>(get_items_expected_max());
-            if(num_min == 0) {
-                num_min = 1;
-            }
-            if(num_max == 0) {
-                num_max = 1;
-            }
-            if(original.size() < num_min) {
-                throw ArgumentMismatch::AtLeast(get_name(), static_cast<int>(num_min), original.size());
-            }
-            if(original.size() > num_max) {
-                throw ArgumentMismatch::AtMost(get_name(), static_cast<int>(num_max), original.size());
-            }
-            break;
-        }
-        }
-    }
+    void _reduce_results(results_t &res, const results_t &original) const;
 
     // Run a result through the Validators
-    std::string _validate(std::string &result, int index) const {
-        std::string err_msg;
-        if(result.empty() && expected_min_ == 0) {
-            // an empty with nothing expected is allowed
-            return err_msg;
-        }
-        for(const auto &vali : validators_) {
-            auto v = vali.get_application_index();
-            if(v == -1 || v == index) {
-                try {
-                    err_msg = vali(result);
-                } catch(const ValidationError &err) {
-                    err_msg = err.what();
-                }
-                if(!err_msg.empty())
-                    break;
-            }
-        }
-
-        return err_msg;
-    }
+    std::string _validate(std::string &result, int index) const;
 
     /// Add a single result to the result set, taking into account delimiters
-    int _add_result(std::string &&result, std::vector<std::string> &res) const {
-        int result_count = 0;
-        if(allow_extra_args_ && !result.empty() && result.front() == '[' &&
-           result.back() == ']') {  // this is now a vector string likely from the default or user entry
-            result.pop_back();
-
-            for(auto &var : CLI::detail::split(result.substr(1), ',')) {
-                if(!var.empty()) {
-                    result_count += _add_result(std::move(var), res);
-                }
-            }
-            return result_count;
-        }
-        if(delimiter_ == '\0') {
-            res.push_back(std::move(result));
-            ++result_count;
-        } else {
-            if((result.find_first_of(delimiter_) != std::string::npos)) {
-                for(const auto &var : CLI::detail::split(result, delimiter_)) {
-                    if(!var.empty()) {
-                        res.push_back(var);
-                        ++result_count;
-                    }
-                }
-            } else {
-                res.push_back(std::move(result));
-                ++result_count;
-            }
-        }
-        return result_count;
-    }
+    int _add_result(std::string &&result, std::vector<std::string> &res) const;
 };  // namespace CLI
 
 // [CLI11:option_hpp:end]
 }  // namespace CLI
+
+#ifndef CLI11_COMPILE
+#include "impl/Option_inl.hpp"
+#endif
@@ -0,0 +1,360 @@
+// Copyright (c) 2017-2021, University of Cincinnati, developed by Henry Schreiner
+// under NSF AWARD 1414736 and by the respective contributors.
+// All rights reserved.
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+// [CLI11:public_includes:set]
+#include <array>
+#include <cstddef>
+#include <string>
+// [CLI11:public_includes:end]
+
+// CLI Library includes
+#include "App.hpp"
+#include "Error.hpp"
+
+namespace CLI {
+// [CLI11:schema_hpp:verbatim]
+
+namespace detail {
+
+// constexpr versions of the name rules in split_names, get_names and, for flags, remove_default_flag_values, written
+// as single return statements so they can be checked at compile time in C++11. A name list is examined one comma
+// separated token at a time; a token is the half open range [b, e) before trimming. In a flag, the '!' of a negated
+// name and a {default} group are not part of the name, so the characters of a name are visited with a cursor that
+// skips them.
+
+/// Whitespace as removed by detail::trim
+constexpr bool schema_is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+/// constexpr version of valid_first_char
+constexpr bool schema_first_char(char c) { return c != '-' && c != '!' && c != ' ' && c != '\n'; }
+
+/// constexpr version of valid_later_char
+constexpr bool schema_later_char(char c) { return c != '=' && c != ':' && c != '{' && c != ' ' && c != '\n'; }
+
+/// Index of the comma or terminator that ends the token containing i
+constexpr std::size_t schema_token_end(const char *s, std::size_t i) {
+    return (s[i] == '\0' || s[i] == ',') ? i : schema_token_end(s, i + 1);
+}
+
+/// Index of the '}' closing a default value opened before i, or e if the token has none
+constexpr std::size_t schema_brace_end(const char *s, std::size_t i, std::size_t e) {
+    return (i == e || s[i] == '}') ? i : schema_brace_end(s, i + 1, e);
+}
+
+/// Check if a {default} group of a flag starts at i
+constexpr bool schema_default_group(const char *s, std::size_t i, std::size_t e, bool flag) {
+    return flag && i < e && s[i] == '{' && schema_brace_end(s, i + 1, e) < e;
+}
+
+/// The first name character at or after i, skipping the '!' and {default} groups of a flag
+constexpr std::size_t schema_skip(const char *s, std::size_t i, std::size_t e, bool flag) {
+    return (flag && i < e && s[i] == '!')       ? schema_skip(s, i + 1, e, flag)
+           : schema_default_group(s, i, e, flag) ? schema_skip(s, schema_brace_end(s, i + 1, e) + 1, e, flag)
+                                                 : i;
+}
+
+/// The name character after the one at i
+constexpr std::size_t schema_next(const char *s, std::size_t i, std::size_t e, bool flag) {
+    return schema_skip(s, i + 1, e, flag);
+}
+
+/// Check if only trailing whitespace is left from the name character at i
+constexpr bool schema_at_end(const char *s, std::size_t i, std::size_t e, bool flag) {
+    return i >= e || (schema_is_space(s[i]) && schema_at_end(s, schema_next(s, i, e, flag), e, flag));
+}
+
+/// The first name character of the token [b, e) after leading whitespace
+constexpr std::size_t schema_start(const char *s, std::size_t b, std::size_t e, bool flag) {
+    return (schema_skip(s, b, e, flag) < e && schema_is_space(s[schema_skip(s, b, e, flag)]))
+               ? schema_start(s, schema_skip(s, b, e, flag) + 1, e, flag)
+               : schema_skip(s, b, e, flag);
+}
+
+/// Number of name characters from i, without trailing whitespace
+constexpr std::size_t schema_length(const char *s, std::size_t i, std::size_t e, bool flag) {
+    return schema_at_end(s, i, e, flag) ? 0 : 1 + schema_length(s, schema_next(s, i, e, flag), e, flag);
+}
+
+/// Check that every name character from i is a valid later character
+constexpr bool schema_later_chars(const char *s, std::size_t i, std::size_t e, bool flag) {
+    return schema_at_end(s, i, e, flag) ||
+           (schema_later_char(s[i]) && schema_later_chars(s, schema_next(s, i, e, flag), e, flag));
+}
+
+/// Classify the name starting at i of length n: 0 empty, 1 short name, 2 long name, 3 positional name, -1 invalid
+constexpr int schema_name_kind(const char *s, std::size_t i, std::size_t e, bool flag, std::size_t n) {
+    return (n == 0) ? 0
+           : (n > 1 && s[i] == '-' && s[schema_next(s, i, e, flag)] != '-')
+               ? ((n == 2 && schema_first_char(s[schema_next(s, i, e, flag)])) ? 1 : -1)
+           : (n > 2 && s[i] == '-' && s[schema_next(s, i, e, flag)] == '-')
+               ? ((schema_first_char(s[schema_next(s, schema_next(s, i, e, flag), e, flag)]) &&
+                   schema_later_chars(
+                       s, schema_next(s, schema_next(s, schema_next(s, i, e, flag), e, flag), e, flag), e, flag))
+                      ? 2
+                      : -1)
+           : (s[i] == '-') ? -1
+                           : 3;
+}
+
+/// Classify the token [b, e), see schema_name_kind
+constexpr int schema_token_kind(const char *s, std::size_t b, std::size_t e, bool flag) {
+    return schema_name_kind(
+        s, schema_start(s, b, e, flag), e, flag, schema_length(s, schema_start(s, b, e, flag), e, flag));
+}
+
+/// Add a token of the given kind to the positional count of the rest of the list, propagating errors
+constexpr int schema_add_positional(int kind, int rest) { return (kind < 0 || rest < 0) ? -1 : rest + (kind == 3); }
+
+/// Number of positional names in the name list starting at i, or -1 if any name is invalid
+constexpr int schema_positional_count(const char *s, bool flag, std::size_t i = 0) {
+    return schema_add_positional(schema_token_kind(s, i, schema_token_end(s, i), flag),
+                                 s[schema_token_end(s, i)] == '\0'
+                                     ? 0
+                                     : schema_positional_count(s, flag, schema_token_end(s, i) + 1));
+}
+
+/// Check a name list the way add_option or add_flag would, including that a flag has no positional name
+constexpr bool schema_names_valid(const char *s, bool flag) {
+    return schema_positional_count(s, flag) >= 0 && schema_positional_count(s, flag) <= (flag ? 0 : 1);
+}
+
+/// Compare the names starting at a[ai] and b[bi]
+constexpr bool schema_name_equal(const char *a,
+                                 std::size_t ai,
+                                 std::size_t ae,
+                                 bool a_flag,
+                                 const char *b,
+                                 std::size_t bi,
+                                 std::size_t be,
+                                 bool b_flag) {
+    return schema_at_end(a, ai, ae, a_flag)
+               ? schema_at_end(b, bi, be, b_flag)
+               : (!schema_at_end(b, bi, be, b_flag) && a[ai] == b[bi] &&
+                  schema_name_equal(a,
+                                    schema_next(a, ai, ae, a_flag),
+                                    ae,
+                                    a_flag,
+                                    b,
+                                    schema_next(b, bi, be, b_flag),
+                                    be,
+                                    b_flag));
+}
+
+/// Check if the name starting at a[ai] is one of the names in the list b starting at i
+constexpr bool schema_list_contains(const char *a,
+                                    std::size_t ai,
+                                    std::size_t ae,
+                                    bool a_flag,
+                                    const char *b,
+                                    bool b_flag,
+                                    std::size_t i = 0) {
+    return schema_name_equal(a,
+                             ai,
+                             ae,
+                             a_flag,
+                             b,
+                             schema_start(b, i, schema_token_end(b, i), b_flag),
+                             schema_token_end(b, i),
+                             b_flag) ||
+           (b[schema_token_end(b, i)] != '\0' &&
+            schema_list_contains(a, ai, ae, a_flag, b, b_flag, schema_token_end(b, i) + 1));
+}
+
+/// Check if the name starting at a[ai] is a short or long name that is also in the list b
+constexpr bool
+schema_shared_name(const char *a, std::size_t ai, std::size_t ae, bool a_flag, const char *b, bool b_flag) {
+    return schema_length(a, ai, ae, a_flag) > 1 && a[ai] == '-' && schema_list_contains(a, ai, ae, a_flag, b, b_flag);
+}
+
+/// Check that no short or long name in the list a (starting at i) is also in the list b; positional names may repeat
+constexpr bool schema_names_disjoint(const char *a, bool a_flag, const char *b, bool b_flag, std::size_t i = 0) {
+    return !schema_shared_name(
+               a, schema_start(a, i, schema_token_end(a, i), a_flag), schema_token_end(a, i), a_flag, b, b_flag) &&
+           (a[schema_token_end(a, i)] == '\0' ||
+            schema_names_disjoint(a, a_flag, b, b_flag, schema_token_end(a, i) + 1));
+}
+
+/// Check the first field against each of the others
+template <typename First> constexpr bool schema_disjoint_with(const First &) { return true; }
+
+template <typename First, typename Second, typename... Rest>
+constexpr bool schema_disjoint_with(const First &first, const Second &second, const Rest &...rest) {
+    return schema_names_disjoint(first.get_names(), first.is_flag(), second.get_names(), second.is_flag()) &&
+           schema_disjoint_with(first, rest...);
+}
+
+/// Check that no two fields share a short or long name
+constexpr bool schema_all_disjoint() { return true; }
+
+template <typename First, typename... Rest>
+constexpr bool schema_all_disjoint(const First &first, const Rest &...rest) {
+    return schema_disjoint_with(first, rest...) && schema_all_disjoint(rest...);
+}
+
+/// Recursive storage for the fields of a schema, std::tuple is not a literal type in C++11
+template <typename... Fields> struct schema_fields;
+
+template <> struct schema_fields<> {
+    constexpr schema_fields() {}
+};
+
+template <typename First, typename... Rest> struct schema_fields<First, Rest...> {
+    constexpr explicit schema_fields(First first_field, Rest... rest_fields)
+        : first(first_field), rest(rest_fields...) {}
+    First first;
+    schema_fields<Rest...> rest;
+};
+
+}  // namespace detail
+
+/// A single option or flag of a Schema, bound to a member of Struct
+template <typename Struct, typename T, bool Flag> class SchemaField {
+    const char *names_;
+    T Struct::*member_;
+    const char *description_;
+    int expected_min_;
+    int expected_max_;
+    bool has_expected_;
+    bool required_;
+
+  public:
+    constexpr SchemaField(const char *names,
+                          T Struct::*member,
+                          const char *description,
+                          int expected_min = 0,
+                          int expected_max = 0,
+                          bool has_expected = false,
+                          bool required = false)
+        : names_(names), member_(member), description_(description), expected_min_(expected_min),
+          expected_max_(expected_max), has_expected_(has_expected), required_(required) {}
+
+    /// Set the number of expected values, see Option::expected
+    constexpr SchemaField expected(int value) const {
+        return SchemaField(names_, member_, description_, value, value, true, required_);
+    }
+
+    /// Set the range of expected values, see Option::expected
+    constexpr SchemaField expected(int value_min, int value_max) const {
+        return SchemaField(names_, member_, description_, value_min, value_max, true, required_);
+    }
+
+    /// Make the option required
+    constexpr SchemaField required(bool value = true) const {
+        return SchemaField(names_, member_, description_, expected_min_, expected_max_, has_expected_, value);
+    }
+
+    /// Get the comma separated names
+    constexpr const char *get_names() const { return names_; }
+
+    /// Check if the field is a flag, whose names may use the {default} and ! syntax of add_flag
+    constexpr bool is_flag() const { return Flag; }
+
+    /// Get the bound member
+    constexpr T Struct::*get_member() const { return member_; }
+
+    /// Get the description
+    constexpr const char *get_description() const { return description_; }
+
+    /// Apply the settings that were not part of binding to a freshly added option
+    Option *apply(Option *opt) const {
+        if(has_expected_)
+            opt->expected(expected_min_, expected_max_);
+        if(required_)
+            opt->required();
+        return opt;
+    }
+};
+
+/// Declare an option bound to a member, the names are checked at compile time when used in a constant expression
+template <typename Struct, typename T>
+constexpr SchemaField<Struct, T, false> field(const char *names, T Struct::*member, const char *description = "") {
+    return detail::schema_names_valid(names, false)
+               ? SchemaField<Struct, T, false>(names, member, description)
+               : throw BadNameString(std::string("Invalid option names in schema: ") + names);
+}
+
+/// Declare a flag bound to a member, integers count repeated flags and other types are set from the flag value
+template <typename Struct, typename T>
+constexpr SchemaField<Struct, T, true> flag(const char *names, T Struct::*member, const char *description = "") {
+    return detail::schema_names_valid(names, true)
+               ? SchemaField<Struct, T, true>(names, member, description)
+               : throw BadNameString(std::string("Invalid flag names in schema: ") + names);
+}
+
+/// A fixed set of options for the members of a Struct, declared and validated at compile time
+template <typename Struct, typename... Fields> class Schema {
+    detail::schema_fields<Fields...> fields_;
+
+    template <std::size_t I>
+    static void bind_fields(App &,
+                            Struct &,
+                            const detail::schema_fields<> &,
+                            std::array<Option *, sizeof...(Fields)> &,
+                            std::size_t) {}
+
+    template <std::size_t I, typename First, typename... Rest>
+    static void bind_fields(App &app,
+                            Struct &target,
+                            const detail::schema_fields<First, Rest...> &fields,
+                            std::array<Option *, sizeof...(Fields)> &options,
+                            std::size_t existing) {
+        options[I] = bind_field(app, target, fields.first, checked_options(app, existing));
+        bind_fields<I + 1>(app, target, fields.rest, options, existing);
+    }
+
+    /// Options within the schema are already known to be distinct, unless names are compared ignoring case or
+    /// underscores, so usually only the options that were there before binding need to be checked
+    static std::size_t checked_options(const App &app, std::size_t existing) {
+        return (app.option_defaults_.get_ignore_case() || app.option_defaults_.get_ignore_underscore())
+                   ? app.options_.size()
+                   : existing;
+    }
+
+    template <typename T>
+    static Option *
+    bind_field(App &app, Struct &target, const SchemaField<Struct, T, false> &entry, std::size_t checked) {
+        Option *opt =
+            app._add_option_internal(entry.get_names(), callback_t{}, entry.get_description(), false, {}, checked);
+        return entry.apply(App::_bind_variable<T, T>(opt, target.*entry.get_member()));
+    }
+
+    template <typename T>
+    static Option *
+    bind_field(App &app, Struct &target, const SchemaField<Struct, T, true> &entry, std::size_t checked) {
+        Option *opt = app._add_flag_internal(entry.get_names(), callback_t{}, entry.get_description(), checked);
+        return entry.apply(App::_bind_flag(opt, target.*entry.get_member()));
+    }
+
+  public:
+    constexpr explicit Schema(Fields... fields) : fields_(fields...) {}
+
+    /// The number of fields
+    static constexpr std::size_t size() { return sizeof...(Fields); }
+
+    /// Add an option for every field to app, bound to the members of target. Returns the options in field order.
+    std::array<Option *, sizeof...(Fields)> bind(App &app, Struct &target) const {
+        std::array<Option *, sizeof...(Fields)> options{};
+        std::size_t existing = app.options_.size();
+        app.options_.reserve(existing + sizeof...(Fields));
+        bind_fields<0>(app, target, fields_, options, existing);
+        return options;
+    }
+};
+
+/// Build a Schema from fields, checking at compile time that no two fields share a name
+template <typename Struct, typename... T, bool... Flag>
+constexpr Schema<Struct, SchemaField<Struct, T, Flag>...> make_schema(SchemaField<Struct, T, Flag>... fields) {
+    return detail::schema_all_disjoint(fields...)
+               ? Schema<Struct, SchemaField<Struct, T, Flag>...>(fields...)
+               : throw OptionAlreadyAdded(std::string("Schema fields share a name"));
+}
+
+// [CLI11:schema_hpp:end]
+}  // namespace CLI
@@ -12,15 +12,299 @@
 #define _GLIBCXX_USE_NANOSLEEP
 #endif
 
+// Hardware counters are read with perf_event_open on Linux, define CLI11_PERF_EVENTS to 0 to leave them out
+#ifndef CLI11_PERF_EVENTS
+#if defined(__linux__)
+#define CLI11_PERF_EVENTS 1
+#else
+#define CLI11_PERF_EVENTS 0
+#endif
+#endif
+
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <functional>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
+
+#if CLI11_PERF_EVENTS
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+#include "StringTools.hpp"
 
 namespace CLI {
 
+/// The hardware events a Timer can count
+enum class TimerCounter : std::size_t { cycles, instructions, cache_misses, branch_misses };
+
+/// Counts of hardware events, an event is missing if it could not be counted
+struct CounterValues {
+    std::array<double, 4> values{{0, 0, 0, 0}};
+    std::array<bool, 4> available{{false, false, false, false}};
+
+    /// The names of the events, in the order of TimerCounter
+    static const std::array<const char *, 4> &names() {
+        static const std::array<const char *, 4> counter_names{
+            {"cycles", "instructions", "cache_misses", "branch_misses"}};
+        return counter_names;
+    }
+
+    bool has(TimerCounter counter) const { return available[static_cast<std::size_t>(counter)]; }
+    double get(TimerCounter counter) const { return values[static_cast<std::size_t>(counter)]; }
+
+    /// True if any event was counted
+    bool any() const { return std::find(available.begin(), available.end(), true) != available.end(); }
+
+    /// The counts from start to this, divided by calls
+    CounterValues since(const CounterValues &start, double calls = 1) const {
+        CounterValues difference;
+        for(std::size_t i = 0; i < values.size(); ++i) {
+            difference.available[i] = available[i] && start.available[i];
+            if(difference.available[i]) {
+                difference.values[i] = (values[i] - start.values[i]) / calls;
+            }
+        }
+        return difference;
+    }
+
+    /// A readable list of the counted events, like "1.2M cycles, 3.4M instructions"
+    std::string to_string() const {
+        static const std::array<const char *, 4> labels{{"cycles", "instructions", "cache misses", "branch misses"}};
+        std::string out;
+        for(std::size_t i = 0; i < values.size(); ++i) {
+            if(available[i]) {
+                if(!out.empty()) {
+                    out += ", ";
+                }
+                out += make_count_str(values[i]) + ' ' + labels[i];
+            }
+        }
+        return out;
+    }
+
+    /// Print a count with a k, M or G suffix
+    static std::string make_count_str(double count) {
+        const char *suffix = "";
+        if(count >= 1e9) {
+            count /= 1e9;
+            suffix = "G";
+        } else if(count >= 1e6) {
+            count /= 1e6;
+            suffix = "M";
+        } else if(count >= 1e3) {
+            count /= 1e3;
+            suffix = "k";
+        }
+        std::array<char, 32> buffer;
+        std::snprintf(buffer.data(), buffer.size(), "%.4g", count);
+        return buffer.data() + std::string(suffix);
+    }
+};
+
+/// Hardware event counters of the calling thread, read with perf_event_open. Nothing is counted if perf events are
+/// not available, for instance in containers or with a restrictive kernel.perf_event_paranoid.
+class PerfCounters {
+  public:
+    PerfCounters() {
+#if CLI11_PERF_EVENTS
+        static const std::array<std::uint64_t, 4> configs{{PERF_COUNT_HW_CPU_CYCLES,
+                                                           PERF_COUNT_HW_INSTRUCTIONS,
+                                                           PERF_COUNT_HW_CACHE_MISSES,
+                                                           PERF_COUNT_HW_BRANCH_MISSES}};
+        int leader{-1};
+        for(std::size_t i = 0; i < configs.size(); ++i) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof(attr);
+            attr.config = configs[i];
+            attr.disabled = leader == -1 ? 1 : 0;
+            // user space only, which restricted kernels still allow for the own process
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            long fd = syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0);
+            if(fd >= 0) {
+                fds_[i] = static_cast<int>(fd);
+                if(leader == -1) {
+                    leader = fds_[i];
+                }
+            }
+        }
+        if(leader != -1) {
+            ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+#endif
+    }
+
+    PerfCounters(const PerfCounters &) = delete;
+    PerfCounters &operator=(const PerfCounters &) = delete;
+
+    ~PerfCounters() {
+#if CLI11_PERF_EVENTS
+        for(int fd : fds_) {
+            if(fd != -1) {
+                close(fd);
+            }
+        }
+#endif
+    }
+
+    /// True if any event is counted
+    bool available() const {
+        return std::find_if(fds_.begin(), fds_.end(), [](int fd) { return fd != -1; }) != fds_.end();
+    }
+
+    /// The counts since the counters were opened, scaled up if the kernel had to share the hardware counters
+    CounterValues read() const {
+        CounterValues counts;
+#if CLI11_PERF_EVENTS
+        for(std::size_t i = 0; i < fds_.size(); ++i) {
+            std::array<std::uint64_t, 3> value{{0, 0, 0}};  // count, time enabled, time running
+            if(fds_[i] != -1 && ::read(fds_[i], value.data(), sizeof(value)) == static_cast<ssize_t>(sizeof(value)) &&
+               value[2] > 0) {
+                counts.values[i] = static_cast<double>(value[0]);
+                if(value[2] < value[1]) {
+                    counts.values[i] *= static_cast<double>(value[1]) / static_cast<double>(value[2]);
+                }
+                counts.available[i] = true;
+            }
+        }
+#endif
+        return counts;
+    }
+
+  private:
+    std::array<int, 4> fds_{{-1, -1, -1, -1}};
+};
+
+/// Settings of Timer::benchmark
+struct BenchmarkOptions {
+    /// Seconds to run the function before measuring, also used to choose the calls per sample
+    double warmup_time{0.1};
+
+    /// Seconds of measurement to aim for
+    double target_time{1};
+
+    /// Fewest samples taken, even if they take longer than target_time
+    std::size_t min_samples{10};
+
+    /// Most samples taken, fast functions are called several times per sample to stay under this
+    std::size_t max_samples{1000};
+
+    /// Leave samples outside of the Tukey fences (1.5 interquartile ranges outside the quartiles) out of the statistics
+    bool reject_outliers{true};
+};
+
+/// The statistics of a benchmark, all times are in seconds per call
+struct BenchmarkResult {
+    std::string title{};
+
+    /// Number of samples kept for the statistics
+    std::size_t samples{0};
+
+    /// Number of samples left out as outliers
+    std::size_t outliers{0};
+
+    /// Calls of the function timed together in each sample
+    std::size_t calls_per_sample{1};
+
+    double min{0};
+    double median{0};
+    double mean{0};
+    double p90{0};
+    double p99{0};
+    double max{0};
+    double stddev{0};
+
+    /// Hardware events per call over all samples, if the Timer counts them
+    CounterValues counters{};
+
+    /// The result as a JSON object, with times in nanoseconds
+    std::string to_json() const {
+        std::string out{"{\"title\":"};
+        detail::append_json_string(out, title);
+        out += ",\"samples\":" + std::to_string(samples) + ",\"outliers\":" + std::to_string(outliers) +
+               ",\"calls_per_sample\":" + std::to_string(calls_per_sample);
+        const char *const names[] = {"min", "median", "mean", "p90", "p99", "max", "stddev"};
+        std::array<double, 7> values = times();
+        for(std::size_t i = 0; i < values.size(); ++i) {
+            out += ",\"" + std::string(names[i]) + "_ns\":" + number(values[i] * 1e9);
+        }
+        for(std::size_t i = 0; i < counters.values.size(); ++i) {
+            if(counters.available[i]) {
+                out += ",\"" + std::string(CounterValues::names()[i]) + "\":" + number(counters.values[i]);
+            }
+        }
+        out.push_back('}');
+        return out;
+    }
+
+    /// The header line for to_csv
+    static std::string csv_header() {
+        return "title,samples,outliers,calls_per_sample,min_ns,median_ns,mean_ns,p90_ns,p99_ns,max_ns,stddev_ns,cycles,"
+               "instructions,cache_misses,branch_misses";
+    }
+
+    /// The result as a line of CSV, with times in nanoseconds and empty fields for events that were not counted
+    std::string to_csv() const {
+        std::string out;
+        if(title.find_first_of(",\"\n") != std::string::npos) {
+            out.push_back('"');
+            for(char c : title) {
+                if(c == '"') {
+                    out.push_back('"');
+                }
+                out.push_back(c);
+            }
+            out.push_back('"');
+        } else {
+            out = title;
+        }
+        out += ',' + std::to_string(samples) + ',' + std::to_string(outliers) + ',' + std::to_string(calls_per_sample);
+        for(double value : times()) {
+            out += ',' + number(value * 1e9);
+        }
+        for(std::size_t i = 0; i < counters.values.size(); ++i) {
+            out.push_back(',');
+            if(counters.available[i]) {
+                out += number(counters.values[i]);
+            }
+        }
+        return out;
+    }
+
+  private:
+    std::array<double, 7> times() const { return {{min, median, mean, p90, p99, max, stddev}}; }
+
+    static std::string number(double value) {
+        std::array<char, 32> buffer;
+        std::snprintf(buffer.data(), buffer.size(), "%.6g", value);
+        return buffer.data();
+    }
+};
+
 /// This is a simple timer with pretty printing. Creating the timer starts counting.
 class Timer {
   protected:
@@ -45,6 +329,12 @@ class Timer {
     /// This is the number of times cycles (print divides by this number)
     std::size_t cycles{1};
 
+    /// The hardware counters, shared by copies of the timer; null unless counters were enabled
+    std::shared_ptr<PerfCounters> counters_{};
+
+    /// The counts when the counters were enabled
+    CounterValues counters_start_{};
+
   public:
     /// Standard print function, this one is set by default
     static std::string Simple(std::string title, std::string time) { return title + ": " + time; }
@@ -78,6 +368,134 @@ class Timer {
         return out;
     }
 
+    /// Count cycles, instructions, cache misses and branch misses of this thread from now on, with perf_event_open
+    /// on Linux. Without perf events the timer keeps measuring wall time only, see counters_available.
+    Timer &counters(bool enable = true) {
+        if(!enable) {
+            counters_.reset();
+        } else if(!counters_) {
+            counters_ = std::make_shared<PerfCounters>();
+            counters_start_ = counters_->read();
+        }
+        return *this;
+    }
+
+    /// True if hardware events are being counted
+    bool counters_available() const { return counters_ && counters_->available(); }
+
+    /// The hardware events since the counters were enabled, divided like the time
+    CounterValues counter_values() const {
+        if(!counters_) {
+            return CounterValues{};
+        }
+        return counters_->read().since(counters_start_, static_cast<double>(cycles));
+    }
+
+    /// Benchmark a function: run it for options.warmup_time, then time samples of several calls until
+    /// options.target_time has passed. The number of calls per sample is chosen from the warm-up so that fast functions
+    /// are measured well above the resolution of the clock.
+    template <typename Callable> BenchmarkResult benchmark(Callable &&f, BenchmarkOptions options = {}) const {
+        using seconds = std::chrono::duration<double>;
+        std::size_t min_samples = (std::max)(options.min_samples, std::size_t{1});
+        std::size_t max_samples = (std::max)(options.max_samples, min_samples);
+
+        // warm up, always at least once, and estimate the time of a call
+        std::size_t warmup_calls{0};
+        time_point start = clock::now();
+        double elapsed{0};
+        do {
+            f();
+            ++warmup_calls;
+            elapsed = seconds(clock::now() - start).count();
+        } while(elapsed < options.warmup_time);
+        double estimate = elapsed / static_cast<double>(warmup_calls);
+
+        BenchmarkResult result;
+        result.title = title_;
+        double sample_time = options.target_time / static_cast<double>(max_samples);
+        if(estimate > 0 && sample_time > estimate) {
+            result.calls_per_sample = static_cast<std::size_t>(std::ceil(sample_time / estimate));
+        }
+
+        std::vector<double> samples;
+        samples.reserve(max_samples);
+        CounterValues counters_before = counters_ ? counters_->read() : CounterValues{};
+        start = clock::now();
+        while(samples.size() < max_samples) {
+            time_point sample_start = clock::now();
+            for(std::size_t i = 0; i < result.calls_per_sample; ++i) {
+                f();
+            }
+            time_point sample_stop = clock::now();
+            samples.push_back(seconds(sample_stop - sample_start).count() /
+                              static_cast<double>(result.calls_per_sample));
+            if(samples.size() >= min_samples && seconds(sample_stop - start).count() >= options.target_time) {
+                break;
+            }
+        }
+        if(counters_) {
+            double calls = static_cast<double>(samples.size() * result.calls_per_sample);
+            result.counters = counters_->read().since(counters_before, calls);
+        }
+
+        std::sort(samples.begin(), samples.end());
+        if(options.reject_outliers && samples.size() >= 4) {
+            double q1 = percentile(samples, 0.25);
+            double q3 = percentile(samples, 0.75);
+            double low = q1 - 1.5 * (q3 - q1);
+            double high = q3 + 1.5 * (q3 - q1);
+            auto first = std::lower_bound(samples.begin(), samples.end(), low);
+            auto last = std::upper_bound(samples.begin(), samples.end(), high);
+            result.outliers = samples.size() - static_cast<std::size_t>(last - first);
+            samples = std::vector<double>(first, last);
+        }
+
+        result.samples = samples.size();
+        result.min = samples.front();
+        result.max = samples.back();
+        result.median = percentile(samples, 0.5);
+        result.p90 = percentile(samples, 0.9);
+        result.p99 = percentile(samples, 0.99);
+        double sum{0};
+        for(double sample : samples) {
+            sum += sample;
+        }
+        result.mean = sum / static_cast<double>(samples.size());
+        if(samples.size() > 1) {
+            double squares{0};
+            for(double sample : samples) {
+                squares += (sample - result.mean) * (sample - result.mean);
+            }
+            result.stddev = std::sqrt(squares / static_cast<double>(samples.size() - 1));
+        }
+        return result;
+    }
+
+    /// The value at a fraction of sorted samples, interpolating between neighbors
+    static double percentile(const std::vector<double> &sorted, double fraction) {
+        double position = fraction * static_cast<double>(sorted.size() - 1);
+        auto lower = static_cast<std::size_t>(position);
+        if(lower + 1 >= sorted.size()) {
+            return sorted.back();
+        }
+        return sorted[lower] + (sorted[lower + 1] - sorted[lower]) * (position - static_cast<double>(lower));
+    }
+
+    /// This formats a benchmark result with the print function
+    std::string to_string(const BenchmarkResult &result) const {
+        std::string time = make_time_str(result.median) + " median (min " + make_time_str(result.min) + ", p90 " +
+                           make_time_str(result.p90) + ", p99 " + make_time_str(result.p99) + ", stddev " +
+                           make_time_str(result.stddev) + ") for " + std::to_string(result.samples) + " samples of " +
+                           std::to_string(result.calls_per_sample);
+        if(result.outliers > 0) {
+            time += ", " + std::to_string(result.outliers) + " outliers";
+        }
+        if(result.counters.any()) {
+            time += ", per call " + result.counters.to_string();
+        }
+        return time_print_(result.title, time);
+    }
+
     /// This formats the numerical value for the time string
     std::string make_time_str() const {
         time_point stop = clock::now();
@@ -108,7 +526,14 @@ class Timer {
     // LCOV_EXCL_STOP
 
     /// This is the main function, it creates a string
-    std::string to_string() const { return time_print_(title_, make_time_str()); }
+    std::string to_string() const {
+        std::string time = make_time_str();
+        CounterValues counts = counter_values();
+        if(counts.any()) {
+            time += ", " + counts.to_string();
+        }
+        return time_print_(title_, time);
+    }
 
     /// Division sets the number of cycles to divide by (no graphical change)
     Timer &operator/(std::size_t val) {
@@ -128,6 +553,241 @@ class AutoTimer : public Timer {
     ~AutoTimer() { std::cout << to_string() << std::endl; }
 };
 
+/// A finished span of time on one thread, see Tracer
+struct TraceEvent {
+    std::string name{};
+    /// Start since the epoch of std::chrono::steady_clock
+    std::chrono::nanoseconds start{0};
+    std::chrono::nanoseconds duration{0};
+};
+
+/// Collects spans of time from any number of threads and writes them in the Chrome trace format (for Perfetto or
+/// chrome://tracing). Each thread appends to its own buffer without locking; a lock is only taken the first time a
+/// thread records into a tracer.
+class Tracer {
+  public:
+    using clock = std::chrono::steady_clock;
+    using time_point = clock::time_point;
+    using recorder_t = std::function<void(const std::string &, time_point, time_point)>;
+
+    Tracer() = default;
+    Tracer(const Tracer &) = delete;
+    Tracer &operator=(const Tracer &) = delete;
+
+    /// The tracer of TraceSpan unless another one is given
+    static Tracer &global() {
+        static Tracer tracer;
+        return tracer;
+    }
+
+    /// Record spans (the default) or ignore them
+    Tracer &enable(bool value = true) {
+        enabled_.store(value, std::memory_order_relaxed);
+        return *this;
+    }
+
+    bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    /// Record a span on the current thread
+    void record(std::string name, time_point start, time_point stop) {
+        if(!enabled()) {
+            return;
+        }
+        ThreadBuffer &buffer = local_buffer();
+        Block *block = buffer.tail;
+        std::size_t size = block->size.load(std::memory_order_relaxed);
+        if(size == block->events.size()) {
+            Block *next = new Block();
+            block->next.store(next, std::memory_order_release);
+            buffer.tail = block = next;
+            size = 0;
+        }
+        TraceEvent &event = block->events[size];
+        event.name = std::move(name);
+        event.start = std::chrono::duration_cast<std::chrono::nanoseconds>(start.time_since_epoch());
+        event.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start);
+        // publish the event to readers on other threads
+        block->size.store(size + 1, std::memory_order_release);
+    }
+
+    /// A function recording into this tracer, with the signature of App::trace_phases
+    recorder_t recorder() {
+        return [this](const std::string &name, time_point start, time_point stop) { record(name, start, stop); };
+    }
+
+    /// Call func with the thread id and each event recorded so far, threads can keep recording meanwhile
+    void for_each(const std::function<void(std::uint64_t, const TraceEvent &)> &func) const {
+        std::vector<const ThreadBuffer *> buffers;
+        {
+            std::lock_guard<std::mutex> lock(buffers_mutex_);
+            for(const std::unique_ptr<ThreadBuffer> &buffer : buffers_) {
+                buffers.push_back(buffer.get());
+            }
+        }
+        for(const ThreadBuffer *buffer : buffers) {
+            const Block *block = &buffer->head;
+            while(block != nullptr) {
+                // a block is full before the next one is linked, so reading next first sees all of its events
+                const Block *next = block->next.load(std::memory_order_acquire);
+                std::size_t size = block->size.load(std::memory_order_acquire);
+                for(std::size_t i = 0; i < size; ++i) {
+                    func(buffer->thread, block->events[i]);
+                }
+                block = next;
+            }
+        }
+    }
+
+    /// The number of threads that recorded into this tracer
+    std::size_t thread_count() const {
+        std::lock_guard<std::mutex> lock(buffers_mutex_);
+        return buffers_.size();
+    }
+
+    /// The number of events recorded so far
+    std::size_t size() const {
+        std::size_t count{0};
+        for_each([&count](std::uint64_t, const TraceEvent &) { ++count; });
+        return count;
+    }
+
+    /// Write the events as Chrome trace JSON, times are in microseconds of std::chrono::steady_clock
+    void write_chrome_trace(std::ostream &out) const {
+        std::string pid = std::to_string(process_id());
+        out << "{\"traceEvents\":[";
+        bool first{true};
+        std::string name;
+        for_each([&](std::uint64_t thread, const TraceEvent &event) {
+            name.clear();
+            detail::append_json_string(name, event.name);
+            out << (first ? "\n" : ",\n") << "{\"name\":" << name
+                << ",\"cat\":\"cli11\",\"ph\":\"X\",\"ts\":" << microseconds(event.start)
+                << ",\"dur\":" << microseconds(event.duration) << ",\"pid\":" << pid << ",\"tid\":" << thread << '}';
+            first = false;
+        });
+        out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    }
+
+    std::string to_chrome_trace() const {
+        std::ostringstream out;
+        write_chrome_trace(out);
+        return out.str();
+    }
+
+    /// Write the global tracer to filename in the Chrome trace format when the program exits
+    static void export_at_exit(std::string filename) {
+        static std::string *export_file = nullptr;
+        if(export_file == nullptr) {
+            // the tracer must be created before the handler is registered, so it is destroyed after it runs
+            global();
+            export_file = new std::string();
+            std::atexit([]() {
+                std::ofstream out(*export_file);
+                global().write_chrome_trace(out);
+            });
+        }
+        *export_file = std::move(filename);
+    }
+
+    ~Tracer() {
+        for(const std::unique_ptr<ThreadBuffer> &buffer : buffers_) {
+            Block *block = buffer->head.next.load(std::memory_order_relaxed);
+            while(block != nullptr) {
+                Block *next = block->next.load(std::memory_order_relaxed);
+                delete block;
+                block = next;
+            }
+        }
+    }
+
+  private:
+    /// A fixed part of a buffer, so that writing never moves events a reader might see
+    struct Block {
+        std::array<TraceEvent, 256> events{};
+        std::atomic<std::size_t> size{0};
+        std::atomic<Block *> next{nullptr};
+    };
+
+    /// The events of one thread, only appended by that thread
+    struct ThreadBuffer {
+        explicit ThreadBuffer(std::uint64_t thread_id) : thread(thread_id) {}
+        ThreadBuffer(const ThreadBuffer &) = delete;
+        ThreadBuffer &operator=(const ThreadBuffer &) = delete;
+        std::uint64_t thread;
+        Block head{};
+        Block *tail{&head};
+    };
+
+    /// The buffer of the current thread, registered on first use
+    ThreadBuffer &local_buffer() {
+        // the buffers are keyed by a serial number, which is never reused like the address of a tracer could be;
+        // the last one used is checked first, so a thread recording into a single tracer does no lookup
+        thread_local std::uint64_t cached_tracer{0};
+        thread_local ThreadBuffer *cached_buffer{nullptr};
+        thread_local std::map<std::uint64_t, ThreadBuffer *> thread_buffers;
+        if(cached_tracer != serial_) {
+            ThreadBuffer *&buffer = thread_buffers[serial_];
+            if(buffer == nullptr) {
+                std::lock_guard<std::mutex> lock(buffers_mutex_);
+                buffers_.emplace_back(new ThreadBuffer(thread_id()));
+                buffer = buffers_.back().get();
+            }
+            cached_buffer = buffer;
+            cached_tracer = serial_;
+        }
+        return *cached_buffer;
+    }
+
+    /// The id of the current thread as the system shows it where possible
+    static std::uint64_t thread_id() {
+#if CLI11_PERF_EVENTS
+        return static_cast<std::uint64_t>(syscall(SYS_gettid));
+#else
+        static std::atomic<std::uint64_t> next_thread{1};
+        thread_local std::uint64_t thread = next_thread++;
+        return thread;
+#endif
+    }
+
+    static std::uint64_t process_id() {
+#if defined(__unix__) || defined(__APPLE__)
+        return static_cast<std::uint64_t>(getpid());
+#else
+        return 1;
+#endif
+    }
+
+    static std::uint64_t next_serial() {
+        static std::atomic<std::uint64_t> serial{1};
+        return serial++;
+    }
+
+    static std::string microseconds(std::chrono::nanoseconds time) {
+        std::array<char, 32> buffer;
+        std::snprintf(buffer.data(), buffer.size(), "%.3f", static_cast<double>(time.count()) / 1000.0);
+        return buffer.data();
+    }
+
+    std::uint64_t serial_{next_serial()};
+    std::atomic<bool> enabled_{true};
+    mutable std::mutex buffers_mutex_{};
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers_{};
+};
+
+/// A Timer that records a span into a Tracer when it is destroyed, spans nest by time on each thread
+class TraceSpan : public Timer {
+  public:
+    explicit TraceSpan(std::string name, Tracer &tracer = Tracer::global())
+        : Timer(std::move(name)), tracer_(&tracer) {}
+    TraceSpan(const TraceSpan &) = delete;
+    TraceSpan &operator=(const TraceSpan &) = delete;
+
+    ~TraceSpan() { tracer_->record(std::move(title_), start_, clock::now()); }
+
+  private:
+    Tracer *tracer_;
+};
+
 }  // namespace CLI
 
 /// This prints out the time if shifted into a std::cout like stream.
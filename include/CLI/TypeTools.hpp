@@ -9,6 +9,8 @@
 // [CLI11:public_includes:set]
 #include <cstdint>
 #include <exception>
+#include <iterator>
+#include <locale>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -190,6 +192,21 @@ template <typename T, typename S = std::istringstream> class is_istreamable {
     static constexpr bool value = decltype(test<T, S>(0))::value;
 };
 
+/// Check for a user supplied parser `bool from_string_view(const char *str, std::size_t length, T &output)` found
+/// through argument dependent lookup
+template <typename T> class has_from_string_view {
+    template <typename TT>
+    static auto test(int) -> decltype(from_string_view(std::declval<const char *>(),
+                                                       std::declval<std::size_t>(),
+                                                       std::declval<TT &>()),
+                                      std::true_type());
+
+    template <typename> static auto test(...) -> std::false_type;
+
+  public:
+    static constexpr bool value = decltype(test<T>(0))::value;
+};
+
 /// Check for complex
 template <typename T> class is_complex {
     template <typename TT>
@@ -201,16 +218,69 @@ template <typename T> class is_complex {
     static constexpr bool value = decltype(test<T>(0))::value;
 };
 
-/// Templated operation to get a value from a stream
-template <typename T, enable_if_t<is_istreamable<T>::value, detail::enabler> = detail::dummy>
-bool from_stream(const std::string &istring, T &obj) {
-    std::istringstream is;
+/// An input stream kept per thread for from_stream, since constructing a stream for every value is expensive
+struct reusable_istream {
+    std::istringstream stream{};
+    bool in_use{false};
+};
+
+/// Get the stream reused by from_stream on this thread
+inline reusable_istream &thread_istream() {
+    static thread_local reusable_istream cached;
+    return cached;
+}
+
+/// Marks the thread stream as in use for the lifetime of the object, so nested conversions get their own stream
+class reusable_istream_lock {
+  public:
+    explicit reusable_istream_lock(reusable_istream &cached) : cached_(cached) { cached_.in_use = true; }
+    ~reusable_istream_lock() { cached_.in_use = false; }
+    reusable_istream_lock(const reusable_istream_lock &) = delete;
+    reusable_istream_lock &operator=(const reusable_istream_lock &) = delete;
+
+  private:
+    reusable_istream &cached_;
+};
+
+/// Read a value from a stream holding the whole string, all characters must be consumed
+template <typename T> bool read_from_istream(std::istringstream &is, const std::string &istring, T &obj) {
     is.str(istring);
     is >> obj;
     return !is.fail() && !is.rdbuf()->in_avail();
 }
 
-template <typename T, enable_if_t<!is_istreamable<T>::value, detail::enabler> = detail::dummy>
+/// Templated operation to get a value from a user supplied from_string_view parser
+template <typename T, enable_if_t<has_from_string_view<T>::value, detail::enabler> = detail::dummy>
+bool from_stream(const std::string &istring, T &obj) {
+    return from_string_view(istring.data(), istring.size(), obj);
+}
+
+/// Templated operation to get a value from a stream
+template <typename T,
+          enable_if_t<!has_from_string_view<T>::value && is_istreamable<T>::value, detail::enabler> = detail::dummy>
+bool from_stream(const std::string &istring, T &obj) {
+    reusable_istream &cached = thread_istream();
+    if(cached.in_use) {
+        std::istringstream is;
+        return read_from_istream(is, istring, obj);
+    }
+    reusable_istream_lock lock(cached);
+    std::istringstream &is = cached.stream;
+    // undo anything the previous value or extraction operator left behind, so the stream behaves like a new one
+    is.clear();
+    is.exceptions(std::ios_base::goodbit);
+    is.flags(std::ios_base::skipws | std::ios_base::dec);
+    is.width(0);
+    is.precision(6);
+    if(is.getloc() != std::locale()) {
+        is.imbue(std::locale());
+    }
+    is.fill(is.widen(' '));
+    return read_from_istream(is, istring, obj);
+}
+
+template <typename T,
+          enable_if_t<!has_from_string_view<T>::value && !is_istreamable<T>::value, detail::enabler> = detail::dummy>
 bool from_stream(const std::string & /*istring*/, T & /*obj*/) {
     return false;
 }
@@ -1069,9 +1139,10 @@ template <typename T,
           enable_if_t<classify_object<T>::value == object_category::other && !std::is_assignable<T &, int>::value,
                       detail::enabler> = detail::dummy>
 bool lexical_cast(const std::string &input, T &output) {
-    static_assert(is_istreamable<T>::value,
-                  "option object type must have a lexical cast overload or streaming input operator(>>) defined, if it "
-                  "is convertible from another type use the add_option<T, XC>(...) with XC being the known type");
+    static_assert(is_istreamable<T>::value || has_from_string_view<T>::value,
+                  "option object type must have a lexical cast overload, a from_string_view function or streaming input "
+                  "operator(>>) defined, if it is convertible from another type use the add_option<T, XC>(...) with XC "
+                  "being the known type");
     return from_stream(input, output);
 }
 
@@ -1488,6 +1559,34 @@ bool lexical_conversion(const std::vector<std::string> &strings, AssignTo &outpu
     return false;
 }
 
+/// Check if the results can be moved directly into the output, true for std::string and std::vector<std::string>
+template <typename AssignTo, typename ConvertTo>
+struct is_string_move_target
+    : std::integral_constant<bool,
+                             std::is_same<AssignTo, ConvertTo>::value &&
+                                 (std::is_same<AssignTo, std::string>::value ||
+                                  std::is_same<AssignTo, std::vector<std::string>>::value)> {};
+
+/// Move the first result into a string output, the result is left empty
+template <typename AssignTo,
+          typename ConvertTo,
+          enable_if_t<is_string_move_target<AssignTo, ConvertTo>::value && std::is_same<AssignTo, std::string>::value,
+                      detail::enabler> = detail::dummy>
+bool lexical_move(std::vector<std::string> &strings, AssignTo &output) {
+    output = std::move(strings[0]);
+    return true;
+}
+
+/// Move all the results into a vector of strings, the results are left as empty strings
+template <typename AssignTo,
+          typename ConvertTo,
+          enable_if_t<is_string_move_target<AssignTo, ConvertTo>::value && !std::is_same<AssignTo, std::string>::value,
+                      detail::enabler> = detail::dummy>
+bool lexical_move(std::vector<std::string> &strings, AssignTo &output) {
+    output.assign(std::make_move_iterator(strings.begin()), std::make_move_iterator(strings.end()));
+    return (!output.empty());
+}
+
 /// Sum a vector of flag representations
 /// The flag vector produces a series of strings in a vector,  simple true is represented by a "1",  simple false is
 /// by
@@ -1543,6 +1642,24 @@ void sum_flag_vector(const std::vector<std::string> &flags, T &output) {
 #pragma warning(pop)
 #endif
 
+/// Get a unique key for a type without requiring RTTI, the address of a static variable is unique per type
+template <typename T> const void *type_key() {
+    static const char key{0};
+    return &key;
+}
+
+/// Check if the result of a conversion can be stored and copied back out of a cache
+template <typename T>
+struct is_cacheable
+    : std::integral_constant<bool, std::is_copy_constructible<T>::value && std::is_copy_assignable<T>::value> {};
+
+/// Check if a cached conversion is a scalar that fits in the inline storage of an Option
+template <typename T>
+struct is_inline_cacheable
+    : std::integral_constant<bool,
+                             (std::is_arithmetic<T>::value || std::is_enum<T>::value) &&
+                                 sizeof(T) <= sizeof(long double) && alignof(T) <= alignof(long double)> {};
+
 }  // namespace detail
 // [CLI11:type_tools_hpp:end]
 }  // namespace CLI
@@ -11,6 +11,7 @@
 #include "TypeTools.hpp"
 
 // [CLI11:public_includes:set]
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <functional>
@@ -79,6 +80,9 @@ class Validator {
     /// This is the description function, if empty the description_ will be used
     std::function<std::string()> desc_function_{[]() { return std::string{}; }};
 
+    /// The values accepted by a set or mapping Validator, empty for other kinds
+    std::function<std::vector<std::string>()> candidates_function_{};
+
     /// This is the base function that is to be called.
     /// Returns a string error message if validation fails.
     std::function<std::string(std::string &)> func_{[](std::string &) { return std::string{}; }};
@@ -129,6 +133,7 @@ class Validator {
     /// Specify the type string
     Validator &description(std::string validator_desc) {
         desc_function_ = [validator_desc]() { return validator_desc; };
+        detail::help_changed();
         return *this;
     }
     /// Specify the type string
@@ -157,9 +162,17 @@ class Validator {
     }
     /// Get the name of the Validator
     const std::string &get_name() const { return name_; }
+    /// Get the values accepted by an IsMember, Transformer or CheckedTransformer, in the order of their set
+    std::vector<std::string> get_candidates() const {
+        if(active_ && candidates_function_) {
+            return candidates_function_();
+        }
+        return std::vector<std::string>{};
+    }
     /// Specify whether the Validator is active or not
     Validator &active(bool active_val = true) {
         active_ = active_val;
+        detail::help_changed();
         return *this;
     }
     /// Specify whether the Validator is active or not
@@ -199,6 +212,7 @@ class Validator {
         Validator newval;
 
         newval._merge_description(*this, other, " AND ");
+        newval._merge_candidates(*this, other, true);
 
         // Give references (will make a copy in lambda function)
         const std::function<std::string(std::string & filename)> &f1 = func_;
@@ -224,6 +238,7 @@ class Validator {
         Validator newval;
 
         newval._merge_description(*this, other, " OR ");
+        newval._merge_candidates(*this, other, false);
 
         // Give references (will make a copy in lambda function)
         const std::function<std::string(std::string &)> &f1 = func_;
@@ -242,7 +257,8 @@ class Validator {
         return newval;
     }
 
-    /// Create a validator that fails when a given validator succeeds
+    /// Create a validator that fails when a given validator succeeds. It has no candidates, since the values it
+    /// accepts are all but those of the given validator.
     Validator operator!() const {
         Validator newval;
         const std::function<std::string()> &dfunc1 = desc_function_;
@@ -280,6 +296,34 @@ class Validator {
             return std::string(1, '(') + f1 + ')' + merger + '(' + f2 + ')';
         };
     }
+
+    /// Combine the candidates of two validators: the values of both if both must pass, otherwise of either one. If
+    /// only one of them lists candidates, those are used.
+    void _merge_candidates(const Validator &val1, const Validator &val2, bool both) {
+        const std::function<std::vector<std::string>()> &cfunc1 = val1.candidates_function_;
+        const std::function<std::vector<std::string>()> &cfunc2 = val2.candidates_function_;
+        if(!cfunc1 || !cfunc2) {
+            candidates_function_ = cfunc1 ? cfunc1 : cfunc2;
+            return;
+        }
+        candidates_function_ = [cfunc1, cfunc2, both]() {
+            std::vector<std::string> first = cfunc1();
+            std::vector<std::string> second = cfunc2();
+            std::vector<std::string> out;
+            for(std::string &value : first) {
+                bool in_second = std::find(second.begin(), second.end(), value) != second.end();
+                if(in_second || !both)
+                    out.push_back(std::move(value));
+            }
+            if(!both) {
+                for(std::string &value : second) {
+                    if(std::find(out.begin(), out.end(), value) == out.end())
+                        out.push_back(std::move(value));
+                }
+            }
+            return out;
+        };
+    }
 };  // namespace CLI
 
 /// Class wrapping some of the accessors of Validator
@@ -554,6 +598,16 @@ template <typename T> std::string generate_set(const T &set) {
     return out;
 }
 
+/// The keys of a set or mapping as strings
+template <typename T> std::vector<std::string> generate_candidates(const T &set) {
+    using element_t = typename detail::element_type<T>::type;
+    std::vector<std::string> out;
+    for(const auto &v : detail::smart_deref(set)) {
+        out.push_back(detail::to_string(detail::pair_adaptor<element_t>::first(v)));
+    }
+    return out;
+}
+
 /// Generate a string representation of a map
 template <typename T> std::string generate_map(const T &map, bool key_only = false) {
     using element_t = typename detail::element_type<T>::type;
@@ -699,6 +753,7 @@ class IsMember : public Validator {
 
         // This is the type name for help, it will take the current version of the set contents
         desc_function_ = [set]() { return detail::generate_set(detail::smart_deref(set)); };
+        candidates_function_ = [set]() { return detail::generate_candidates(detail::smart_deref(set)); };
 
         // This is the function that validates
         // It stores a copy of the set pointer-like, so shared_ptr will stay alive
@@ -769,6 +824,7 @@ class Transformer : public Validator {
 
         // This is the type name for help, it will take the current version of the set contents
         desc_function_ = [mapping]() { return detail::generate_map(detail::smart_deref(mapping)); };
+        candidates_function_ = [mapping]() { return detail::generate_candidates(detail::smart_deref(mapping)); };
 
         func_ = [mapping, filter_fn](std::string &input) {
             local_item_t b;
@@ -838,6 +894,7 @@ class CheckedTransformer : public Validator {
         };
 
         desc_function_ = tfunc;
+        candidates_function_ = [mapping]() { return detail::generate_candidates(detail::smart_deref(mapping)); };
 
         func_ = [mapping, tfunc, filter_fn](std::string &input) {
             local_item_t b;
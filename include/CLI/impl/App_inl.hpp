@@ -0,0 +1,3341 @@
+// Copyright (c) 2017-2021, University of Cincinnati, developed by Henry Schreiner
+// under NSF AWARD 1414736 and by the respective contributors.
+// All rights reserved.
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+// This include is only needed for IDEs to discover symbols
+#include "../App.hpp"
+
+// [CLI11:public_includes:set]
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <iterator>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+// [CLI11:public_includes:end]
+
+namespace CLI {
+// [CLI11:app_inl_hpp:verbatim]
+
+CLI11_INLINE GroupView::iterator &GroupView::iterator::operator++() {
+    const std::vector<Option_p> &options = *options_;
+    while(++index_ < options.size()) {
+        const std::string &group = options[index_]->get_group();
+        // options of a group are usually together, so only a change of group needs a search
+        if(group == options[index_ - 1]->get_group()) {
+            continue;
+        }
+        auto seen = std::find_if(options.begin(), options.begin() + static_cast<std::ptrdiff_t>(index_ - 1),
+                                 [&group](const Option_p &opt) { return opt->get_group() == group; });
+        if(seen == options.begin() + static_cast<std::ptrdiff_t>(index_ - 1)) {
+            break;
+        }
+    }
+    return *this;
+}
+
+CLI11_INLINE const PhaseRecord *ParseProfile::find(const std::string &app, ParsePhase phase) const {
+    for(const PhaseRecord &record : records_) {
+        if(record.phase == phase && record.app == app) {
+            return &record;
+        }
+    }
+    return nullptr;
+}
+
+CLI11_INLINE std::chrono::nanoseconds ParseProfile::library_time() const {
+    std::chrono::nanoseconds time{0};
+    for(const PhaseRecord &record : records_) {
+        if(record.phase != ParsePhase::user_callback) {
+            time += record.self;
+        }
+    }
+    return time;
+}
+
+CLI11_INLINE std::chrono::nanoseconds ParseProfile::user_time() const {
+    std::chrono::nanoseconds time{0};
+    for(const PhaseRecord &record : records_) {
+        if(record.phase == ParsePhase::user_callback) {
+            time += record.self;
+        }
+    }
+    return time;
+}
+
+CLI11_INLINE AllocationCount ParseProfile::library_allocations() const {
+    AllocationCount allocations;
+    for(const PhaseRecord &record : records_) {
+        if(record.phase != ParsePhase::user_callback) {
+            allocations.count += record.allocations.count;
+            allocations.bytes += record.allocations.bytes;
+        }
+    }
+    return allocations;
+}
+
+CLI11_INLINE AllocationCount ParseProfile::user_allocations() const {
+    AllocationCount allocations;
+    for(const PhaseRecord &record : records_) {
+        if(record.phase == ParsePhase::user_callback) {
+            allocations.count += record.allocations.count;
+            allocations.bytes += record.allocations.bytes;
+        }
+    }
+    return allocations;
+}
+
+CLI11_INLINE std::string ParseProfile::to_string() const {
+    std::size_t width{3};
+    for(const PhaseRecord &record : records_) {
+        width = (std::max)(width, record.app.size());
+    }
+    std::stringstream out;
+    bool counted = detail::allocations_counted();
+    out << std::left << std::setw(static_cast<int>(width)) << "app" << "  " << std::setw(13) << "phase" << std::right
+        << std::setw(7) << "calls" << std::setw(12) << "total us" << std::setw(12) << "self us";
+    if(counted) {
+        out << std::setw(9) << "allocs" << std::setw(11) << "bytes";
+    }
+    out << '\n';
+    auto micro = [](std::chrono::nanoseconds time) { return static_cast<double>(time.count()) / 1000.0; };
+    out << std::fixed << std::setprecision(1);
+    for(const PhaseRecord &record : records_) {
+        out << std::left << std::setw(static_cast<int>(width)) << record.app << "  " << std::setw(13)
+            << CLI::to_string(record.phase) << std::right << std::setw(7) << record.calls << std::setw(12)
+            << micro(record.total) << std::setw(12) << micro(record.self);
+        if(counted) {
+            out << std::setw(9) << record.allocations.count << std::setw(11) << record.allocations.bytes;
+        }
+        out << '\n';
+    }
+    out << "library " << micro(library_time()) << " us, user " << micro(user_time()) << " us\n";
+    if(counted) {
+        AllocationCount library = library_allocations();
+        AllocationCount user = user_allocations();
+        out << "library " << library.count << " allocations (" << library.bytes << " bytes), user " << user.count
+            << " allocations (" << user.bytes << " bytes)\n";
+    }
+    return out.str();
+}
+
+CLI11_INLINE void ParseProfile::clear() {
+    records_.clear();
+    apps_.clear();
+    stack_.clear();
+    thread_ = std::thread::id{};
+}
+
+CLI11_INLINE void ParseProfile::begin(const App *app, ParsePhase phase) {
+    // the first phase claims the thread, callbacks run on other threads by callback_threads are not recorded
+    std::thread::id id = std::this_thread::get_id();
+    if(thread_ == std::thread::id{}) {
+        thread_ = id;
+    } else if(id != thread_) {
+        return;
+    }
+    std::size_t index{0};
+    while(index < records_.size() && (apps_[index] != app || records_[index].phase != phase)) {
+        ++index;
+    }
+    if(index == records_.size()) {
+        PhaseRecord record;
+        for(const App *current = app; current != nullptr; current = current->get_parent()) {
+            std::string name = current->get_parent() == nullptr ? current->get_name() : current->get_display_name();
+            if(!name.empty()) {
+                record.app = record.app.empty() ? std::move(name) : name + ' ' + record.app;
+            }
+        }
+        record.phase = phase;
+        records_.push_back(std::move(record));
+        apps_.push_back(app);
+    }
+    ++records_[index].calls;
+    stack_.push_back(Frame{index, clock::time_point{}, clock::duration::zero(), {}, {}});
+    // start counting last so the bookkeeping above is not counted
+    stack_.back().start_allocations = detail::thread_allocations();
+    stack_.back().start = clock::now();
+}
+
+CLI11_INLINE void ParseProfile::end() {
+    if(std::this_thread::get_id() != thread_ || stack_.empty()) {
+        return;
+    }
+    clock::time_point now = clock::now();
+    const AllocationCount &allocated = detail::thread_allocations();
+    Frame frame = stack_.back();
+    stack_.pop_back();
+    clock::duration elapsed = now - frame.start;
+    std::size_t count = allocated.count - frame.start_allocations.count;
+    std::size_t bytes = allocated.bytes - frame.start_allocations.bytes;
+    PhaseRecord &record = records_[frame.record];
+    record.total += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed);
+    record.self += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed - frame.nested);
+    record.allocations.count += count - frame.nested_allocations.count;
+    record.allocations.bytes += bytes - frame.nested_allocations.bytes;
+    if(span_) {
+        span_(record.app.empty() ? CLI::to_string(record.phase) : record.app + ' ' + CLI::to_string(record.phase),
+              frame.start,
+              now);
+        // leave the span out of the enclosing phase too
+        elapsed = clock::now() - frame.start;
+        count = allocated.count - frame.start_allocations.count;
+        bytes = allocated.bytes - frame.start_allocations.bytes;
+    }
+    if(!stack_.empty()) {
+        Frame &parent = stack_.back();
+        parent.nested += elapsed;
+        parent.nested_allocations.count += count;
+        parent.nested_allocations.bytes += bytes;
+    }
+}
+
+CLI11_INLINE std::vector<Option *> ParseOrder::to_vector() const {
+    std::vector<Option *> options;
+    options.reserve(size_);
+    for(const Span &span : spans_) {
+        options.insert(options.end(), span.count, span.option);
+    }
+    return options;
+}
+
+CLI11_INLINE void ParseOrder::push_back(Option *opt, std::size_t position) {
+    Span *last = spans_.empty() ? nullptr : &spans_.back();
+    if(last != nullptr && last->option == opt && (last->count == 1 || last->repeated) && last->position == position) {
+        last->repeated = true;
+        ++last->count;
+    } else if(last != nullptr && last->option == opt && !last->repeated && last->position + last->count == position) {
+        ++last->count;
+    } else {
+        spans_.push_back(Span{opt, 1, position, false});
+    }
+    ++size_;
+}
+
+CLI11_INLINE std::vector<const Option *> InvocationRecord::options() const {
+    std::vector<const Option *> opts;
+    opts.reserve(entries_.size());
+    for(const Entry &entry : entries_) {
+        opts.push_back(entry.option);
+    }
+    return opts;
+}
+
+CLI11_INLINE std::size_t InvocationRecord::count(const std::string &option_name) const {
+    const Entry *entry = _find(option_name);
+    return (entry == nullptr) ? 0 : entry->end - entry->begin;
+}
+
+CLI11_INLINE std::vector<std::string> InvocationRecord::results(const std::string &option_name) const {
+    const Entry *entry = _find(option_name);
+    if(entry == nullptr) {
+        return std::vector<std::string>{};
+    }
+    auto begin = values_.begin() + static_cast<std::ptrdiff_t>(entry->begin);
+    return std::vector<std::string>(begin, begin + static_cast<std::ptrdiff_t>(entry->end - entry->begin));
+}
+
+CLI11_INLINE void InvocationRecord::add(const Option *opt, std::vector<std::string> &values) {
+    std::size_t begin = values_.size();
+    values_.insert(values_.end(), std::make_move_iterator(values.begin()), std::make_move_iterator(values.end()));
+    entries_.push_back(Entry{opt, begin, values_.size()});
+}
+
+CLI11_INLINE const InvocationRecord::Entry *InvocationRecord::_find(const std::string &option_name) const {
+    for(const Entry &entry : entries_) {
+        if(entry.option->check_name(option_name)) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+CLI11_INLINE App::App(std::string app_description, std::string app_name, App *parent)
+    : name_(std::move(app_name)), description_(std::move(app_description)), parent_(parent) {
+    // Inherit if not from a nullptr
+    if(parent_ != nullptr) {
+        if(parent_->help_ptr_ != nullptr)
+            set_help_flag(parent_->help_ptr_->get_name(false, true), parent_->help_ptr_->get_description());
+        if(parent_->help_all_ptr_ != nullptr)
+            set_help_all_flag(parent_->help_all_ptr_->get_name(false, true),
+                              parent_->help_all_ptr_->get_description());
+
+        /// OptionDefaults
+        option_defaults_ = parent_->option_defaults_;
+
+        // INHERITABLE
+        failure_message_ = parent_->failure_message_;
+        allow_extras_ = parent_->allow_extras_;
+        allow_config_extras_ = parent_->allow_config_extras_;
+        prefix_command_ = parent_->prefix_command_;
+        immediate_callback_ = parent_->immediate_callback_;
+        ignore_case_ = parent_->ignore_case_;
+        ignore_underscore_ = parent_->ignore_underscore_;
+        fallthrough_ = parent_->fallthrough_;
+        validate_positionals_ = parent_->validate_positionals_;
+        configurable_ = parent_->configurable_;
+        allow_windows_style_options_ = parent_->allow_windows_style_options_;
+        group_ = parent_->group_;
+        footer_ = parent_->footer_;
+        formatter_ = parent_->formatter_;
+        cache_help_ = parent_->cache_help_;
+        config_formatter_ = parent_->config_formatter_;
+        require_subcommand_max_ = parent_->require_subcommand_max_;
+        parse_limits_ = parent_->parse_limits_;
+        profile_ = parent_->profile_;
+    }
+}
+
+CLI11_INLINE App *App::callback(std::function<void()> app_callback) {
+    if(immediate_callback_) {
+        parse_complete_callback_ = std::move(app_callback);
+    } else {
+        final_callback_ = std::move(app_callback);
+    }
+    return this;
+}
+
+CLI11_INLINE App *App::final_callback(std::function<void()> app_callback) {
+    final_callback_ = std::move(app_callback);
+    return this;
+}
+
+CLI11_INLINE App *App::parse_complete_callback(std::function<void()> pc_callback) {
+    parse_complete_callback_ = std::move(pc_callback);
+    return this;
+}
+
+CLI11_INLINE App *App::preparse_callback(std::function<void(std::size_t)> pp_callback) {
+    pre_parse_callback_ = std::move(pp_callback);
+    return this;
+}
+
+CLI11_INLINE App *App::name(std::string app_name) {
+
+    if(parent_ != nullptr) {
+        auto oname = name_;
+        name_ = app_name;
+        auto &res = _compare_subcommand_names(*this, *_get_fallthrough_parent());
+        if(!res.empty()) {
+            name_ = oname;
+            throw(OptionAlreadyAdded(app_name + " conflicts with existing subcommand names"));
+        }
+    } else {
+        name_ = app_name;
+    }
+    has_automatic_name_ = false;
+    detail::help_changed();
+    return this;
+}
+
+CLI11_INLINE App *App::alias(std::string app_name) {
+    if(app_name.empty() || !detail::valid_alias_name_string(app_name)) {
+        throw IncorrectConstruction("Aliases may not be empty or contain newlines or null characters");
+    }
+    if(parent_ != nullptr) {
+        aliases_.push_back(app_name);
+        auto &res = _compare_subcommand_names(*this, *_get_fallthrough_parent());
+        if(!res.empty()) {
+            aliases_.pop_back();
+            throw(OptionAlreadyAdded("alias already matches an existing subcommand: " + app_name));
+        }
+    } else {
+        aliases_.push_back(app_name);
+    }
+
+    detail::help_changed();
+    return this;
+}
+
+CLI11_INLINE App *App::allow_extras(bool allow) {
+    allow_extras_ = allow;
+    return this;
+}
+
+CLI11_INLINE App *App::required(bool require) {
+    required_ = require;
+    detail::help_changed();
+    return this;
+}
+
+CLI11_INLINE App *App::disabled(bool disable) {
+    disabled_ = disable;
+    detail::help_changed();
+    return this;
+}
+
+CLI11_INLINE App *App::silent(bool silence) {
+    silent_ = silence;
+    return this;
+}
+
+CLI11_INLINE App *App::disabled_by_default(bool disable) {
+    if(disable) {
+        default_startup = startup_mode::disabled;
+    } else {
+        default_startup = (default_startup == startup_mode::enabled) ? startup_mode::enabled : startup_mode::stable;
+    }
+    return this;
+}
+
+CLI11_INLINE App *App::enabled_by_default(bool enable) {
+    if(enable) {
+        default_startup = startup_mode::enabled;
+    } else {
+        default_startup =
+            (default_startup == startup_mode::disabled) ? startup_mode::disabled : startup_mode::stable;
+    }
+    return this;
+}
+
+CLI11_INLINE App *App::immediate_callback(bool immediate) {
+    immediate_callback_ = immediate;
+    if(immediate_callback_) {
+        if(final_callback_ && !(parse_complete_callback_)) {
+            std::swap(final_callback_, parse_complete_callback_);
+        }
+    } else if(!(final_callback_) && parse_complete_callback_) {
+        std::swap(final_callback_, parse_complete_callback_);
+    }
+    return this;
+}
+
+CLI11_INLINE App *App::callback_threads(std::size_t threads) {
+    if(threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    callback_threads_ = (threads == 0) ? 1 : threads;
+    return this;
+}
+
+CLI11_INLINE App *App::validate_positionals(bool validate) {
+    validate_positionals_ = validate;
+    return this;
+}
+
+CLI11_INLINE App *App::allow_config_extras(bool allow) {
+    if(allow) {
+        allow_config_extras_ = config_extras_mode::capture;
+        allow_extras_ = true;
+    } else {
+        allow_config_extras_ = config_extras_mode::error;
+    }
+    return this;
+}
+
+CLI11_INLINE App *App::allow_config_extras(config_extras_mode mode) {
+    allow_config_extras_ = mode;
+    return this;
+}
+
+CLI11_INLINE App *App::prefix_command(bool allow) {
+    prefix_command_ = allow;
+    return this;
+}
+
+CLI11_INLINE App *App::ignore_case(bool value) {
+    if(value && !ignore_case_) {
+        ignore_case_ = true;
+        auto *p = (parent_ != nullptr) ? _get_fallthrough_parent() : this;
+        auto &match = _compare_subcommand_names(*this, *p);
+        if(!match.empty()) {
+            ignore_case_ = false;  // we are throwing so need to be exception invariant
+            throw OptionAlreadyAdded("ignore case would cause subcommand name conflicts: " + match);
+        }
+    }
+    ignore_case_ = value;
+    return this;
+}
+
+CLI11_INLINE App *App::allow_windows_style_options(bool value) {
+    allow_windows_style_options_ = value;
+    return this;
+}
+
+CLI11_INLINE App *App::positionals_at_end(bool value) {
+    positionals_at_end_ = value;
+    return this;
+}
+
+CLI11_INLINE App *App::configurable(bool value) {
+    configurable_ = value;
+    return this;
+}
+
+CLI11_INLINE App *App::ignore_underscore(bool value) {
+    if(value && !ignore_underscore_) {
+        ignore_underscore_ = true;
+        auto *p = (parent_ != nullptr) ? _get_fallthrough_parent() : this;
+        auto &match = _compare_subcommand_names(*this, *p);
+        if(!match.empty()) {
+            ignore_underscore_ = false;
+            throw OptionAlreadyAdded("ignore underscore would cause subcommand name conflicts: " + match);
+        }
+    }
+    ignore_underscore_ = value;
+    return this;
+}
+
+CLI11_INLINE App *App::formatter(std::shared_ptr<FormatterBase> fmt) {
+    formatter_ = fmt;
+    detail::help_changed();
+    return this;
+}
+
+CLI11_INLINE App *App::formatter_fn(std::function<std::string(const App *, std::string, AppFormatMode)> fmt) {
+    formatter_ = std::make_shared<FormatterLambda>(fmt);
+    detail::help_changed();
+    return this;
+}
+
+CLI11_INLINE App *App::config_formatter(std::shared_ptr<Config> fmt) {
+    config_formatter_ = fmt;
+    return this;
+}
+
+CLI11_INLINE Option *App::add_option(std::string option_name,
+                                     callback_t option_callback,
+                                     std::string option_description,
+                                     bool defaulted,
+                                     std::function<std::string()> func) {
+    return _add_option_internal(std::move(option_name),
+                                std::move(option_callback),
+                                std::move(option_description),
+                                defaulted,
+                                std::move(func),
+                                options_.size());
+}
+
+CLI11_INLINE Option *App::_add_option_internal(std::string option_name,
+                                               callback_t option_callback,
+                                               std::string option_description,
+                                               bool defaulted,
+                                               std::function<std::string()> func,
+                                               std::size_t checked_options) {
+    // construct the option once and only keep it if none of its names are taken
+    Option_p option{
+        new Option(std::move(option_name), std::move(option_description), std::move(option_callback), this)};
+
+    auto checked_end = options_.begin() + static_cast<std::ptrdiff_t>(checked_options);
+    if(std::find_if(options_.begin(), checked_end, [&option](const Option_p &v) { return *v == *option; }) ==
+       checked_end) {
+        options_.push_back(std::move(option));
+        Option *opt = options_.back().get();
+        detail::help_changed();
+
+        // Set the default string capture function
+        opt->default_function(func);
+
+        // For compatibility with CLI11 1.7 and before, capture the default string here
+        if(defaulted)
+            opt->capture_default_str();
+
+        // Transfer defaults to the new option
+        option_defaults_.copy_to(opt);
+
+        // Don't bother to capture if we already did
+        if(!defaulted && opt->get_always_capture_default())
+            opt->capture_default_str();
+
+        return opt;
+    }
+    // we know something matches now find what it is so we can produce more error information
+    for(auto &opt : options_) {
+        auto &matchname = opt->matching_name(*option);
+        if(!matchname.empty()) {
+            throw(OptionAlreadyAdded("added option matched existing option name: " + matchname));
+        }
+    }
+    // this line should not be reached the above loop should trigger the throw
+    throw(OptionAlreadyAdded("added option matched existing option name"));  // LCOV_EXCL_LINE
+}
+
+CLI11_INLINE Option *App::set_help_flag(std::string flag_name, const std::string &help_description) {
+    // take flag_description by const reference otherwise add_flag tries to assign to help_description
+    if(help_ptr_ != nullptr) {
+        remove_option(help_ptr_);
+        help_ptr_ = nullptr;
+    }
+
+    // Empty name will simply remove the help flag
+    if(!flag_name.empty()) {
+        help_ptr_ = add_flag(flag_name, help_description);
+        help_ptr_->configurable(false);
+    }
+
+    return help_ptr_;
+}
+
+CLI11_INLINE Option *App::set_help_all_flag(std::string help_name, const std::string &help_description) {
+    // take flag_description by const reference otherwise add_flag tries to assign to flag_description
+    if(help_all_ptr_ != nullptr) {
+        remove_option(help_all_ptr_);
+        help_all_ptr_ = nullptr;
+    }
+
+    // Empty name will simply remove the help all flag
+    if(!help_name.empty()) {
+        help_all_ptr_ = add_flag(help_name, help_description);
+        help_all_ptr_->configurable(false);
+    }
+
+    return help_all_ptr_;
+}
+
+CLI11_INLINE Option *App::set_version_flag(std::string flag_name,
+                                           const std::string &versionString,
+                                           const std::string &version_help) {
+    // take flag_description by const reference otherwise add_flag tries to assign to version_description
+    if(version_ptr_ != nullptr) {
+        remove_option(version_ptr_);
+        version_ptr_ = nullptr;
+    }
+
+    // Empty name will simply remove the version flag
+    if(!flag_name.empty()) {
+        version_ptr_ = add_flag_callback(
+            flag_name, [versionString]() { throw(CLI::CallForVersion(versionString, 0)); }, version_help);
+        version_ptr_->configurable(false);
+    }
+
+    return version_ptr_;
+}
+
+CLI11_INLINE Option *App::set_version_flag(std::string flag_name,
+                                           std::function<std::string()> vfunc,
+                                           const std::string &version_help) {
+    if(version_ptr_ != nullptr) {
+        remove_option(version_ptr_);
+        version_ptr_ = nullptr;
+    }
+
+    // Empty name will simply remove the version flag
+    if(!flag_name.empty()) {
+        version_ptr_ = add_flag_callback(
+            flag_name, [vfunc]() { throw(CLI::CallForVersion(vfunc(), 0)); }, version_help);
+        version_ptr_->configurable(false);
+    }
+
+    return version_ptr_;
+}
+
+CLI11_INLINE Option *App::_add_flag_internal(std::string flag_name,
+                                             CLI::callback_t fun,
+                                             std::string flag_description,
+                                             std::size_t checked_options) {
+    Option *opt;
+    if(detail::has_default_flag_values(flag_name)) {
+        // check for default values and if it has them
+        auto flag_defaults = detail::get_default_flag_values(flag_name);
+        detail::remove_default_flag_values(flag_name);
+        opt = _add_option_internal(
+            std::move(flag_name), std::move(fun), std::move(flag_description), false, {}, checked_options);
+        for(const auto &fname : flag_defaults)
+            opt->fnames_.push_back(fname.first);
+        opt->default_flag_values_ = std::move(flag_defaults);
+    } else {
+        opt = _add_option_internal(
+            std::move(flag_name), std::move(fun), std::move(flag_description), false, {}, checked_options);
+    }
+    // flags cannot have positional values
+    if(opt->get_positional()) {
+        auto pos_name = opt->get_name(true);
+        remove_option(opt);
+        throw IncorrectConstruction::PositionalFlag(pos_name);
+    }
+    opt->multi_option_policy(MultiOptionPolicy::TakeLast);
+    opt->expected(0);
+    opt->required(false);
+    return opt;
+}
+
+CLI11_INLINE Option *App::add_flag_callback(std::string flag_name,
+                                            std::function<void(void)> function,
+                                            std::string flag_description) {
+
+    CLI::callback_t fun = [this, function](const CLI::results_t &res) {
+        bool trigger{false};
+        auto result = CLI::detail::lexical_cast(res[0], trigger);
+        if(result && trigger) {
+            detail::ProfileScope scope(profile_, this, ParsePhase::user_callback);
+            function();
+        }
+        return result;
+    };
+    return _add_flag_internal(flag_name, std::move(fun), std::move(flag_description));
+}
+
+CLI11_INLINE Option *App::add_flag_function(std::string flag_name,
+                                            std::function<void(std::int64_t)> function,
+                                            std::string flag_description) {
+
+    CLI::callback_t fun = [this, function](const CLI::results_t &res) {
+        std::int64_t flag_count = 0;
+        detail::sum_flag_vector(res, flag_count);
+        detail::ProfileScope scope(profile_, this, ParsePhase::user_callback);
+        function(flag_count);
+        return true;
+    };
+    Option *opt = _add_flag_internal(flag_name, std::move(fun), std::move(flag_description));
+    opt->sum_flags_ = true;
+    return opt->multi_option_policy(MultiOptionPolicy::TakeAll);
+}
+
+CLI11_INLINE Option *App::set_config(std::string option_name,
+                                     std::string default_filename,
+                                     const std::string &help_message,
+                                     bool config_required) {
+
+    // Remove existing config if present
+    if(config_ptr_ != nullptr) {
+        remove_option(config_ptr_);
+        config_ptr_ = nullptr;  // need to remove the config_ptr completely
+    }
+
+    // Only add config if option passed
+    if(!option_name.empty()) {
+        config_ptr_ = add_option(option_name, help_message);
+        if(config_required) {
+            config_ptr_->required();
+        }
+        if(!default_filename.empty()) {
+            config_ptr_->default_str(std::move(default_filename));
+        }
+        config_ptr_->configurable(false);
+    }
+
+    return config_ptr_;
+}
+
+CLI11_INLINE bool App::remove_option(Option *opt) {
+    // Make sure no links exist
+    for(Option_p &op : options_) {
+        op->remove_needs(opt);
+        op->remove_excludes(opt);
+    }
+
+    if(help_ptr_ == opt)
+        help_ptr_ = nullptr;
+    if(help_all_ptr_ == opt)
+        help_all_ptr_ = nullptr;
+
+    auto iterator =
+        std::find_if(std::begin(options_), std::end(options_), [opt](const Option_p &v) { return v.get() == opt; });
+    if(iterator != std::end(options_)) {
+        options_.erase(iterator);
+        detail::help_changed();
+        return true;
+    }
+    return false;
+}
+
+CLI11_INLINE App *App::add_subcommand(std::string subcommand_name, std::string subcommand_description) {
+    if(!subcommand_name.empty() && !detail::valid_name_string(subcommand_name)) {
+        if(!detail::valid_first_char(subcommand_name[0])) {
+            throw IncorrectConstruction(
+                "Subcommand name starts with invalid character, '!' and '-' are not allowed");
+        }
+        for(auto c : subcommand_name) {
+            if(!detail::valid_later_char(c)) {
+                throw IncorrectConstruction(std::string("Subcommand name contains invalid character ('") + c +
+                                            "'), all characters are allowed except"
+                                            "'=',':','{','}', and ' '");
+            }
+        }
+    }
+    CLI::App_p subcom = std::shared_ptr<App>(new App(std::move(subcommand_description), subcommand_name, this));
+    return add_subcommand(std::move(subcom));
+}
+
+CLI11_INLINE App *App::add_subcommand(CLI::App_p subcom) {
+    if(!subcom)
+        throw IncorrectConstruction("passed App is not valid");
+    auto ckapp = (name_.empty() && parent_ != nullptr) ? _get_fallthrough_parent() : this;
+    auto &mstrg = _compare_subcommand_names(*subcom, *ckapp);
+    if(!mstrg.empty()) {
+        throw(OptionAlreadyAdded("subcommand name or alias matches existing subcommand: " + mstrg));
+    }
+    subcom->parent_ = this;
+    subcommands_.push_back(std::move(subcom));
+    detail::help_changed();
+    return subcommands_.back().get();
+}
+
+CLI11_INLINE bool App::remove_subcommand(App *subcom) {
+    // Make sure no links exist
+    for(App_p &sub : subcommands_) {
+        sub->remove_excludes(subcom);
+        sub->remove_needs(subcom);
+    }
+
+    auto iterator = std::find_if(
+        std::begin(subcommands_), std::end(subcommands_), [subcom](const App_p &v) { return v.get() == subcom; });
+    if(iterator != std::end(subcommands_)) {
+        subcommands_.erase(iterator);
+        detail::help_changed();
+        return true;
+    }
+    return false;
+}
+
+CLI11_INLINE App *App::get_subcommand(const App *subcom) const {
+    if(subcom == nullptr)
+        throw OptionNotFound("nullptr passed");
+    for(const App_p &subcomptr : subcommands_)
+        if(subcomptr.get() == subcom)
+            return subcomptr.get();
+    throw OptionNotFound(subcom->get_name());
+}
+
+CLI11_INLINE App *App::get_subcommand(std::string subcom) const {
+    auto subc = _find_subcommand(subcom, false, false);
+    if(subc == nullptr)
+        throw OptionNotFound(subcom);
+    return subc;
+}
+
+CLI11_INLINE App *App::get_subcommand(int index) const {
+    if(index >= 0) {
+        auto uindex = static_cast<unsigned>(index);
+        if(uindex < subcommands_.size())
+            return subcommands_[uindex].get();
+    }
+    throw OptionNotFound(std::to_string(index));
+}
+
+CLI11_INLINE CLI::App_p App::get_subcommand_ptr(App *subcom) const {
+    if(subcom == nullptr)
+        throw OptionNotFound("nullptr passed");
+    for(const App_p &subcomptr : subcommands_)
+        if(subcomptr.get() == subcom)
+            return subcomptr;
+    throw OptionNotFound(subcom->get_name());
+}
+
+CLI11_INLINE CLI::App_p App::get_subcommand_ptr(std::string subcom) const {
+    for(const App_p &subcomptr : subcommands_)
+        if(subcomptr->check_name(subcom))
+            return subcomptr;
+    throw OptionNotFound(subcom);
+}
+
+CLI11_INLINE CLI::App_p App::get_subcommand_ptr(int index) const {
+    if(index >= 0) {
+        auto uindex = static_cast<unsigned>(index);
+        if(uindex < subcommands_.size())
+            return subcommands_[uindex];
+    }
+    throw OptionNotFound(std::to_string(index));
+}
+
+CLI11_INLINE App *App::get_option_group(std::string group_name) const {
+    for(const App_p &app : subcommands_) {
+        if(app->name_.empty() && app->group_ == group_name) {
+            return app.get();
+        }
+    }
+    throw OptionNotFound(group_name);
+}
+
+CLI11_INLINE std::size_t App::count_all() const {
+    std::size_t cnt{0};
+    for(auto &opt : options_) {
+        cnt += opt->count();
+    }
+    for(auto &sub : subcommands_) {
+        cnt += sub->count_all();
+    }
+    if(!get_name().empty()) {  // for named subcommands add the number of times the subcommand was called
+        cnt += parsed_;
+    }
+    return cnt;
+}
+
+CLI11_INLINE App *App::group(std::string group_name) {
+    group_ = group_name;
+    detail::help_changed();
+    return this;
+}
+
+CLI11_INLINE App *App::require_subcommand() {
+    require_subcommand_min_ = 1;
+    require_subcommand_max_ = 0;
+    detail::help_changed();
+    return this;
+}
+
+CLI11_INLINE App *App::require_subcommand(int value) {
+    if(value < 0) {
+        require_subcommand_min_ = 0;
+        require_subcommand_max_ = static_cast<std::size_t>(-value);
+    } else {
+        require_subcommand_min_ = static_cast<std::size_t>(value);
+        require_subcommand_max_ = static_cast<std::size_t>(value);
+    }
+    detail::help_changed();
+    return this;
+}
+
+CLI11_INLINE App *App::require_subcommand(std::size_t min, std::size_t max) {
+    require_subcommand_min_ = min;
+    require_subcommand_max_ = max;
+    detail::help_changed();
+    return this;
+}
+
+CLI11_INLINE App *App::require_option() {
+    require_option_min_ = 1;
+    require_option_max_ = 0;
+    detail::help_changed();
+    return this;
+}
+
+CLI11_INLINE App *App::require_option(int value) {
+    if(value < 0) {
+        require_option_min_ = 0;
+        require_option_max_ = static_cast<std::size_t>(-value);
+    } else {
+        require_option_min_ = static_cast<std::size_t>(value);
+        require_option_max_ = static_cast<std::size_t>(value);
+    }
+    detail::help_changed();
+    return this;
+}
+
+CLI11_INLINE App *App::require_option(std::size_t min, std::size_t max) {
+    require_option_min_ = min;
+    require_option_max_ = max;
+    detail::help_changed();
+    return this;
+}
+
+CLI11_INLINE App *App::fallthrough(bool value) {
+    fallthrough_ = value;
+    return this;
+}
+
+CLI11_INLINE void App::clear() {
+
+    parsed_ = 0;
+    pre_parse_called_ = false;
+
+    missing_.clear();
+    argv_ = nullptr;
+    argc_ = 0;
+    passthrough_size_ = 0;
+    passthrough_values_.clear();
+    passthrough_argv_.clear();
+    parse_order_.clear();
+    parsed_subcommands_.clear();
+    invocations_.clear();
+    if(profile_ && parent_ == nullptr) {
+        profile_->clear();
+    }
+    for(const Option_p &opt : options_) {
+        opt->clear();
+    }
+    for(const App_p &subc : subcommands_) {
+        subc->clear();
+    }
+}
+
+CLI11_INLINE void App::parse(int argc, const char *const *argv) {
+    // If the name is not set, read from command line
+    if(name_.empty() || has_automatic_name_) {
+        has_automatic_name_ = true;
+        name_ = argv[0];
+    }
+
+    // clear here so the argv is kept for this parse
+    if(parsed_ > 0)
+        clear();
+    // checked before copying, the byte limit is checked by parse(std::vector<std::string>)
+    if(parse_limits_.max_tokens != 0 && static_cast<std::size_t>(argc) - 1 > parse_limits_.max_tokens)
+        throw LimitError::Tokens(parse_limits_.max_tokens);
+    std::vector<std::string> args;
+    {
+        detail::ProfileScope scope(profile_, this, ParsePhase::tokenize);
+        args.reserve(static_cast<std::size_t>(argc) - 1);
+        for(int i = argc - 1; i > 0; i--) {
+            args.emplace_back(argv[i]);
+        }
+    }
+    argv_ = argv;
+    argc_ = static_cast<std::size_t>(argc);
+    parse(std::move(args));
+}
+
+CLI11_INLINE void App::parse(std::string commandline, bool program_name_included) {
+    if(parse_limits_.max_bytes != 0 && commandline.size() > parse_limits_.max_bytes)
+        throw LimitError::Bytes(parse_limits_.max_bytes);
+
+    // clear here so the profile keeps the tokenizing
+    if(parsed_ > 0)
+        clear();
+    std::vector<std::string> args;
+    {
+        detail::ProfileScope scope(profile_, this, ParsePhase::tokenize);
+        args = _split_commandline(std::move(commandline), program_name_included);
+    }
+    parse(std::move(args));
+}
+
+CLI11_INLINE std::vector<std::string> App::_split_commandline(std::string commandline, bool program_name_included) {
+
+    if(program_name_included) {
+        auto nstr = detail::split_program_name(commandline);
+        if((name_.empty()) || (has_automatic_name_)) {
+            has_automatic_name_ = true;
+            name_ = nstr.first;
+        }
+        commandline = std::move(nstr.second);
+    } else {
+        detail::trim(commandline);
+    }
+    // the next section of code is to deal with quoted arguments after an '=' or ':' for windows like operations
+    if(!commandline.empty()) {
+        commandline = detail::find_and_modify(commandline, "=", detail::escape_detect);
+        if(allow_windows_style_options_)
+            commandline = detail::find_and_modify(commandline, ":", detail::escape_detect);
+    }
+
+    auto args = detail::split_up(std::move(commandline), '\0', parse_limits_.max_tokens);
+    // remove all empty strings
+    args.erase(std::remove(args.begin(), args.end(), std::string{}), args.end());
+    std::reverse(args.begin(), args.end());
+    return args;
+}
+
+CLI11_INLINE void App::parse(std::vector<std::string> &args) {
+    // Clear if parsed
+    if(parsed_ > 0)
+        clear();
+    _check_input_size(args);
+
+    // parsed_ is incremented in commands/subcommands,
+    // but placed here to make sure this is cleared when
+    // running parse after an error is thrown, even by _validate or _configure.
+    parsed_ = 1;
+    _validate();
+    _configure();
+    // set the parent as nullptr as this object should be the top now
+    parent_ = nullptr;
+    parsed_ = 0;
+
+    _parse(args);
+    run_callback();
+}
+
+CLI11_INLINE void App::parse(std::vector<std::string> &&args) {
+    // Clear if parsed
+    if(parsed_ > 0)
+        clear();
+    _check_input_size(args);
+
+    // parsed_ is incremented in commands/subcommands,
+    // but placed here to make sure this is cleared when
+    // running parse after an error is thrown, even by _validate or _configure.
+    parsed_ = 1;
+    _validate();
+    _configure();
+    // set the parent as nullptr as this object should be the top now
+    parent_ = nullptr;
+    parsed_ = 0;
+
+    _parse(std::move(args));
+    run_callback();
+}
+
+CLI11_INLINE void App::parse_from_stream(std::istream &input) {
+    if(parsed_ == 0) {
+        _validate();
+        _configure();
+        // set the parent as nullptr as this object should be the top now
+    }
+
+    _parse_stream(input);
+    run_callback();
+}
+
+CLI11_INLINE int App::exit(const Error &e, std::ostream &out, std::ostream &err) const {
+
+    /// Avoid printing anything if this is a CLI::RuntimeError
+    if(e.get_name() == "RuntimeError")
+        return e.get_exit_code();
+
+    if(e.get_name() == "CallForHelp") {
+        help(out);
+        return e.get_exit_code();
+    }
+
+    if(e.get_name() == "CallForAllHelp") {
+        help(out, "", AppFormatMode::All);
+        return e.get_exit_code();
+    }
+
+    if(e.get_name() == "CallForHelpSearch") {
+        out << help_search(e.what());
+        return e.get_exit_code();
+    }
+
+    if(e.get_name() == "CallForVersion") {
+        out << e.what() << std::endl;
+        return e.get_exit_code();
+    }
+
+    if(e.get_exit_code() != static_cast<int>(ExitCodes::Success)) {
+        if(failure_message_)
+            err << failure_message_(this, e) << std::flush;
+    }
+
+    return e.get_exit_code();
+}
+
+CLI11_INLINE std::vector<const App *> App::get_subcommands(const std::function<bool(const App *)> &filter) const {
+    std::vector<const App *> subcomms(subcommands_.size());
+    std::transform(std::begin(subcommands_), std::end(subcommands_), std::begin(subcomms), [](const App_p &v) {
+        return v.get();
+    });
+
+    if(filter) {
+        subcomms.erase(std::remove_if(std::begin(subcomms),
+                                      std::end(subcomms),
+                                      [&filter](const App *app) { return !filter(app); }),
+                       std::end(subcomms));
+    }
+
+    return subcomms;
+}
+
+CLI11_INLINE std::vector<App *> App::get_subcommands(const std::function<bool(App *)> &filter) {
+    std::vector<App *> subcomms(subcommands_.size());
+    std::transform(std::begin(subcommands_), std::end(subcommands_), std::begin(subcomms), [](const App_p &v) {
+        return v.get();
+    });
+
+    if(filter) {
+        subcomms.erase(
+            std::remove_if(std::begin(subcomms), std::end(subcomms), [&filter](App *app) { return !filter(app); }),
+            std::end(subcomms));
+    }
+
+    return subcomms;
+}
+
+CLI11_INLINE bool App::got_subcommand(const App *subcom) const {
+    // get subcom needed to verify that this was a real subcommand
+    return get_subcommand(subcom)->parsed_ > 0;
+}
+
+CLI11_INLINE App *App::excludes(Option *opt) {
+    if(opt == nullptr) {
+        throw OptionNotFound("nullptr passed");
+    }
+    exclude_options_.insert(opt);
+    detail::help_changed();
+    return this;
+}
+
+CLI11_INLINE App *App::excludes(App *app) {
+    if(app == nullptr) {
+        throw OptionNotFound("nullptr passed");
+    }
+    if(app == this) {
+        throw OptionNotFound("cannot self reference in needs");
+    }
+    auto res = exclude_subcommands_.insert(app);
+    // subcommand exclusion should be symmetric
+    if(res.second) {
+        app->exclude_subcommands_.insert(this);
+    }
+    detail::help_changed();
+    return this;
+}
+
+CLI11_INLINE App *App::needs(Option *opt) {
+    if(opt == nullptr) {
+        throw OptionNotFound("nullptr passed");
+    }
+    need_options_.insert(opt);
+    detail::help_changed();
+    return this;
+}
+
+CLI11_INLINE App *App::needs(App *app) {
+    if(app == nullptr) {
+        throw OptionNotFound("nullptr passed");
+    }
+    if(app == this) {
+        throw OptionNotFound("cannot self reference in needs");
+    }
+    need_subcommands_.insert(app);
+    detail::help_changed();
+    return this;
+}
+
+CLI11_INLINE bool App::remove_excludes(Option *opt) {
+    auto iterator = std::find(std::begin(exclude_options_), std::end(exclude_options_), opt);
+    if(iterator == std::end(exclude_options_)) {
+        return false;
+    }
+    exclude_options_.erase(iterator);
+    detail::help_changed();
+    return true;
+}
+
+CLI11_INLINE bool App::remove_excludes(App *app) {
+    auto iterator = std::find(std::begin(exclude_subcommands_), std::end(exclude_subcommands_), app);
+    if(iterator == std::end(exclude_subcommands_)) {
+        return false;
+    }
+    auto other_app = *iterator;
+    exclude_subcommands_.erase(iterator);
+    other_app->remove_excludes(this);
+    detail::help_changed();
+    return true;
+}
+
+CLI11_INLINE bool App::remove_needs(Option *opt) {
+    auto iterator = std::find(std::begin(need_options_), std::end(need_options_), opt);
+    if(iterator == std::end(need_options_)) {
+        return false;
+    }
+    need_options_.erase(iterator);
+    detail::help_changed();
+    return true;
+}
+
+CLI11_INLINE bool App::remove_needs(App *app) {
+    auto iterator = std::find(std::begin(need_subcommands_), std::end(need_subcommands_), app);
+    if(iterator == std::end(need_subcommands_)) {
+        return false;
+    }
+    need_subcommands_.erase(iterator);
+    detail::help_changed();
+    return true;
+}
+
+CLI11_INLINE App *App::footer(std::string footer_string) {
+    footer_ = std::move(footer_string);
+    detail::help_changed();
+    return this;
+}
+
+CLI11_INLINE App *App::footer(std::function<std::string()> footer_function) {
+    footer_callback_ = std::move(footer_function);
+    detail::help_changed();
+    return this;
+}
+
+CLI11_INLINE std::string App::help(std::string prev, AppFormatMode mode) const {
+    const App *app = _help_app(prev);
+    detail::ProfileScope scope(profile_, app, ParsePhase::help);
+    // a footer callback can change at any time so that help is never cached
+    if(!app->cache_help_ || app->footer_callback_) {
+        return app->formatter_->make_help(app, std::move(prev), mode);
+    }
+    std::lock_guard<std::mutex> lock(app->help_cache_mutex_);
+    return app->_cached_help(std::move(prev), mode);
+}
+
+CLI11_INLINE void App::help(std::ostream &out, std::string prev, AppFormatMode mode) const {
+    const App *app = _help_app(prev);
+    detail::ProfileScope scope(profile_, app, ParsePhase::help);
+    if(!app->cache_help_ || app->footer_callback_) {
+        app->formatter_->write_help(out, app, std::move(prev), mode);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(app->help_cache_mutex_);
+    out << app->_cached_help(std::move(prev), mode);
+}
+
+CLI11_INLINE std::string App::help_search(const std::string &term, std::string prev) const {
+    const App *app = _help_app(prev);
+    std::vector<HelpMatch> matches;
+    {
+        std::lock_guard<std::mutex> lock(app->help_cache_mutex_);
+        matches = app->_search_help(term);
+    }
+    return app->formatter_->make_search(app, std::move(prev), term, matches);
+}
+
+CLI11_INLINE const App *App::_help_app(std::string &prev) const {
+    if(prev.empty())
+        prev = get_name();
+    else
+        prev += " " + get_name();
+
+    // Delegate to subcommand if needed
+    auto selected_subcommands = get_subcommands();
+    if(!selected_subcommands.empty()) {
+        return selected_subcommands.at(0)->_help_app(prev);
+    }
+    return this;
+}
+
+CLI11_INLINE const std::string &App::_cached_help(std::string prev, AppFormatMode mode) const {
+    HelpCacheEntry &cached = help_cache_[static_cast<std::size_t>(mode)];
+    // read before rendering, so a change made while rendering leaves the entry stale
+    std::size_t generation = detail::help_generation();
+    if(cached.generation != generation || cached.prev != prev) {
+        cached.text = formatter_->make_help(this, prev, mode);
+        cached.prev = std::move(prev);
+        cached.generation = generation;
+    }
+    return cached.text;
+}
+
+CLI11_INLINE std::vector<HelpMatch> App::_search_help(const std::string &term) const {
+    std::size_t generation = detail::help_generation();
+    if(help_index_.generation != generation) {
+        help_index_ = HelpIndex{};
+        _index_help(this, this);
+        help_index_.generation = generation;
+    }
+
+    // Each word of the term is a prefix; collect the entries under every indexed word with that prefix and keep
+    // only the entries found for all of the words, so the work depends on the matches and not the App size
+    std::vector<std::size_t> found;
+    bool first{true};
+    for(const std::string &word : _help_words(term)) {
+        std::vector<std::size_t> hits;
+        for(auto it = help_index_.words.lower_bound(word);
+            it != help_index_.words.end() && it->first.compare(0, word.size(), word) == 0;
+            ++it) {
+            hits.insert(hits.end(), it->second.begin(), it->second.end());
+        }
+        std::sort(hits.begin(), hits.end());
+        hits.erase(std::unique(hits.begin(), hits.end()), hits.end());
+        if(first) {
+            found = std::move(hits);
+            first = false;
+        } else {
+            std::vector<std::size_t> both;
+            std::set_intersection(found.begin(), found.end(), hits.begin(), hits.end(), std::back_inserter(both));
+            found = std::move(both);
+        }
+        if(found.empty())
+            break;
+    }
+
+    std::vector<HelpMatch> matches;
+    matches.reserve(found.size());
+    for(std::size_t index : found)
+        matches.push_back(help_index_.entries[index]);
+    return matches;
+}
+
+CLI11_INLINE void App::_index_help(const App *owner, const App *app) const {
+    for(const Option *opt : app->get_options()) {
+        // options in a nameless option group are listed under the group of the option group
+        std::string group = app->get_name().empty() && app != owner ? app->get_group() : opt->get_group();
+        if(group.empty() || opt->get_group().empty())
+            continue;
+        HelpMatch entry;
+        entry.app = owner;
+        entry.option = opt;
+        entry.group = group;
+        _index_help_entry(std::move(entry), opt->get_name(true, true) + ' ' + opt->get_description() + ' ' + group);
+    }
+
+    std::vector<const App *> named;
+    for(const App *sub : app->get_subcommands({})) {
+        if(sub->get_group().empty())
+            continue;
+        if(sub->get_name().empty()) {
+            _index_help(owner, sub);
+            continue;
+        }
+        HelpMatch entry;
+        entry.app = owner;
+        entry.subcommand = sub;
+        entry.group = sub->get_group();
+        _index_help_entry(std::move(entry),
+                          sub->get_name() + ' ' + detail::join(sub->get_aliases(), " ") + ' ' +
+                              sub->get_description() + ' ' + sub->get_group());
+        named.push_back(sub);
+    }
+    for(const App *sub : named)
+        _index_help(sub, sub);
+}
+
+CLI11_INLINE void App::_index_help_entry(HelpMatch entry, const std::string &text) const {
+    std::size_t index = help_index_.entries.size();
+    help_index_.entries.push_back(std::move(entry));
+    for(const std::string &word : _help_words(text)) {
+        std::vector<std::size_t> &postings = help_index_.words[word];
+        // entries are added in order, so a repeated word only needs a check of the last one
+        if(postings.empty() || postings.back() != index)
+            postings.push_back(index);
+    }
+}
+
+CLI11_INLINE std::vector<std::string> App::_help_words(const std::string &text) {
+    std::vector<std::string> words;
+    std::string word;
+    for(char c : text) {
+        if(std::isalnum(static_cast<unsigned char>(c)) != 0) {
+            word.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+        } else if(!word.empty()) {
+            words.push_back(std::move(word));
+            word.clear();
+        }
+    }
+    if(!word.empty())
+        words.push_back(std::move(word));
+    return words;
+}
+
+CLI11_INLINE bool App::_is_help_search_term(const std::string &value) {
+    if(value.empty())
+        return false;
+    std::int64_t number{0};
+    if(detail::integral_conversion(value, number))
+        return false;
+    std::string lower = detail::to_lower(value);
+    if(lower.size() == 1)
+        return std::string("tfyn+-").find(lower[0]) == std::string::npos;
+    return lower != "true" && lower != "false" && lower != "on" && lower != "off" && lower != "yes" &&
+           lower != "no" && lower != "enable" && lower != "disable";
+}
+
+CLI11_INLINE std::string App::export_json() const {
+    std::string out;
+    _export_json(out);
+    return out;
+}
+
+namespace detail {
+
+/// The names of a set of options or subcommands, sorted so the output does not depend on pointer order
+template <typename T> std::vector<std::string> sorted_names(const std::set<T *> &items) {
+    std::vector<std::string> names;
+    names.reserve(items.size());
+    for(const T *item : items)
+        names.push_back(item->get_name());
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+}  // namespace detail
+
+CLI11_INLINE void App::_export_json(std::string &out) const {
+    out += "{\"name\":";
+    detail::append_json_string(out, name_);
+    out += ",\"description\":";
+    detail::append_json_string(out, description_);
+    out += ",\"aliases\":";
+    detail::append_json_array(out, aliases_);
+    out += ",\"group\":";
+    detail::append_json_string(out, group_);
+    out += ",\"footer\":";
+    detail::append_json_string(out, footer_);
+    detail::append_json_bool(out, "required", required_);
+    detail::append_json_bool(out, "disabled", disabled_);
+    detail::append_json_bool(out, "fallthrough", fallthrough_);
+    detail::append_json_bool(out, "allow_extras", allow_extras_);
+    detail::append_json_bool(out, "prefix_command", prefix_command_);
+    detail::append_json_bool(out, "positionals_at_end", positionals_at_end_);
+    detail::append_json_range(out, "require_subcommand", require_subcommand_min_, require_subcommand_max_);
+    detail::append_json_range(out, "require_option", require_option_min_, require_option_max_);
+    out += ",\"need_options\":";
+    detail::append_json_array(out, detail::sorted_names(need_options_));
+    out += ",\"need_subcommands\":";
+    detail::append_json_array(out, detail::sorted_names(need_subcommands_));
+    out += ",\"exclude_options\":";
+    detail::append_json_array(out, detail::sorted_names(exclude_options_));
+    out += ",\"exclude_subcommands\":";
+    detail::append_json_array(out, detail::sorted_names(exclude_subcommands_));
+
+    out += ",\"options\":[";
+    for(const Option_p &opt : options_) {
+        if(out.back() != '[')
+            out.push_back(',');
+        _export_option_json(out, opt.get());
+    }
+    out += "],\"subcommands\":[";
+    for(const App_p &sub : subcommands_) {
+        if(out.back() != '[')
+            out.push_back(',');
+        sub->_export_json(out);
+    }
+    out += "]}";
+}
+
+CLI11_INLINE void App::_export_option_json(std::string &out, const Option *opt) {
+    static const char *const policies[] = {"Throw", "TakeLast", "TakeFirst", "Join", "TakeAll"};
+
+    out += "{\"snames\":";
+    detail::append_json_array(out, opt->snames_);
+    out += ",\"lnames\":";
+    detail::append_json_array(out, opt->lnames_);
+    out += ",\"pname\":";
+    detail::append_json_string(out, opt->pname_);
+    out += ",\"envname\":";
+    detail::append_json_string(out, opt->envname_);
+    out += ",\"description\":";
+    detail::append_json_string(out, opt->description_);
+    out += ",\"group\":";
+    detail::append_json_string(out, opt->group_);
+    out += ",\"type\":";
+    detail::append_json_string(out, opt->type_name_());
+    detail::append_json_range(out, "type_size", opt->type_size_min_, opt->type_size_max_);
+    detail::append_json_range(out, "expected", opt->expected_min_, opt->expected_max_);
+    detail::append_json_bool(out, "required", opt->required_);
+    out += ",\"multi_option_policy\":\"";
+    out += policies[static_cast<std::size_t>(opt->multi_option_policy_)];
+    out += "\",\"default\":";
+    detail::append_json_string(out, opt->get_default_str());
+    out += ",\"needs\":";
+    detail::append_json_array(out, detail::sorted_names(opt->needs_));
+    out += ",\"excludes\":";
+    detail::append_json_array(out, detail::sorted_names(opt->excludes_));
+    out += ",\"validators\":[";
+    for(const Validator &validator : opt->validators_) {
+        if(out.back() != '[')
+            out.push_back(',');
+        out += "{\"name\":";
+        detail::append_json_string(out, validator.get_name());
+        out += ",\"description\":";
+        detail::append_json_string(out, validator.get_description());
+        out += ",\"candidates\":";
+        detail::append_json_array(out, validator.get_candidates());
+        out.push_back('}');
+    }
+    out += "]}";
+}
+
+CLI11_INLINE std::string App::version() const {
+    std::string val;
+    if(version_ptr_ != nullptr) {
+        auto rv = version_ptr_->results();
+        version_ptr_->clear();
+        version_ptr_->add_result("true");
+        try {
+            version_ptr_->run_callback();
+        } catch(const CLI::CallForVersion &cfv) {
+            val = cfv.what();
+        }
+        version_ptr_->clear();
+        version_ptr_->add_result(rv);
+    }
+    return val;
+}
+
+CLI11_INLINE std::shared_ptr<ConfigBase> App::get_config_formatter_base() const {
+    // This is safer as a dynamic_cast if we have RTTI, as Config -> ConfigBase
+#if defined(__cpp_rtti) || (defined(__GXX_RTTI) && __GXX_RTTI) || (defined(_HAS_STATIC_RTTI) && (_HAS_STATIC_RTTI == 0))
+    return std::dynamic_pointer_cast<ConfigBase>(config_formatter_);
+#else
+    return std::static_pointer_cast<ConfigBase>(config_formatter_);
+#endif
+}
+
+CLI11_INLINE App *App::description(std::string app_description) {
+    description_ = std::move(app_description);
+    detail::help_changed();
+    return this;
+}
+
+CLI11_INLINE std::vector<const Option *> App::get_options(const std::function<bool(const Option *)> filter) const {
+    std::vector<const Option *> options(options_.size());
+    std::transform(std::begin(options_), std::end(options_), std::begin(options), [](const Option_p &val) {
+        return val.get();
+    });
+
+    if(filter) {
+        options.erase(std::remove_if(std::begin(options),
+                                     std::end(options),
+                                     [&filter](const Option *opt) { return !filter(opt); }),
+                      std::end(options));
+    }
+
+    return options;
+}
+
+CLI11_INLINE std::vector<Option *> App::get_options(const std::function<bool(Option *)> filter) {
+    std::vector<Option *> options(options_.size());
+    std::transform(std::begin(options_), std::end(options_), std::begin(options), [](const Option_p &val) {
+        return val.get();
+    });
+
+    if(filter) {
+        options.erase(
+            std::remove_if(std::begin(options), std::end(options), [&filter](Option *opt) { return !filter(opt); }),
+            std::end(options));
+    }
+
+    return options;
+}
+
+CLI11_INLINE Option *App::get_option_no_throw(std::string option_name) noexcept {
+    for(Option_p &opt : options_) {
+        if(opt->check_name(option_name)) {
+            return opt.get();
+        }
+    }
+    for(auto &subc : subcommands_) {
+        // also check down into nameless subcommands
+        if(subc->get_name().empty()) {
+            auto opt = subc->get_option_no_throw(option_name);
+            if(opt != nullptr) {
+                return opt;
+            }
+        }
+    }
+    return nullptr;
+}
+
+CLI11_INLINE const Option *App::get_option_no_throw(std::string option_name) const noexcept {
+    for(const Option_p &opt : options_) {
+        if(opt->check_name(option_name)) {
+            return opt.get();
+        }
+    }
+    for(const auto &subc : subcommands_) {
+        // also check down into nameless subcommands
+        if(subc->get_name().empty()) {
+            auto opt = subc->get_option_no_throw(option_name);
+            if(opt != nullptr) {
+                return opt;
+            }
+        }
+    }
+    return nullptr;
+}
+
+CLI11_INLINE const Option *App::get_option(std::string option_name) const {
+    auto opt = get_option_no_throw(option_name);
+    if(opt == nullptr) {
+        throw OptionNotFound(option_name);
+    }
+    return opt;
+}
+
+CLI11_INLINE Option *App::get_option(std::string option_name) {
+    auto opt = get_option_no_throw(option_name);
+    if(opt == nullptr) {
+        throw OptionNotFound(option_name);
+    }
+    return opt;
+}
+
+CLI11_INLINE App *App::clear_aliases() {
+    aliases_.clear();
+    return this;
+}
+
+CLI11_INLINE std::string App::get_display_name(bool with_aliases) const {
+    if(name_.empty()) {
+        return std::string("[Option Group: ") + get_group() + "]";
+    }
+    if(aliases_.empty() || !with_aliases) {
+        return name_;
+    }
+    std::string dispname = name_;
+    for(const auto &lalias : aliases_) {
+        dispname.push_back(',');
+        dispname.push_back(' ');
+        dispname.append(lalias);
+    }
+    return dispname;
+}
+
+CLI11_INLINE bool App::check_name(std::string name_to_check) const {
+    std::string local_name = name_;
+    if(ignore_underscore_) {
+        local_name = detail::remove_underscore(name_);
+        name_to_check = detail::remove_underscore(name_to_check);
+    }
+    if(ignore_case_) {
+        local_name = detail::to_lower(name_);
+        name_to_check = detail::to_lower(name_to_check);
+    }
+
+    if(local_name == name_to_check) {
+        return true;
+    }
+    for(auto les : aliases_) {
+        if(ignore_underscore_) {
+            les = detail::remove_underscore(les);
+        }
+        if(ignore_case_) {
+            les = detail::to_lower(les);
+        }
+        if(les == name_to_check) {
+            return true;
+        }
+    }
+    return false;
+}
+
+CLI11_INLINE std::vector<std::string> App::get_groups() const {
+    GroupView groups = groups_view();
+    return std::vector<std::string>(groups.begin(), groups.end());
+}
+
+CLI11_INLINE std::vector<std::string> App::remaining(bool recurse) const {
+    std::vector<std::string> miss_list;
+    for(const std::pair<detail::Classifier, std::string> &miss : missing_) {
+        miss_list.push_back(std::get<1>(miss));
+    }
+    for(const char *arg : passthrough()) {
+        miss_list.emplace_back(arg);
+    }
+    // Get from a subcommand that may allow extras
+    if(recurse) {
+        if(!allow_extras_) {
+            for(const auto &sub : subcommands_) {
+                if(sub->name_.empty() && !sub->missing_.empty()) {
+                    for(const std::pair<detail::Classifier, std::string> &miss : sub->missing_) {
+                        miss_list.push_back(std::get<1>(miss));
+                    }
+                }
+            }
+        }
+        // Recurse into subcommands
+
+        for(const App *sub : parsed_subcommands_) {
+            std::vector<std::string> output = sub->remaining(recurse);
+            std::copy(std::begin(output), std::end(output), std::back_inserter(miss_list));
+        }
+    }
+    return miss_list;
+}
+
+CLI11_INLINE std::vector<std::string> App::remaining_for_passthrough(bool recurse) const {
+    std::vector<std::string> miss_list = remaining(recurse);
+    std::reverse(std::begin(miss_list), std::end(miss_list));
+    return miss_list;
+}
+
+CLI11_INLINE ArgvView App::passthrough() const {
+    if(passthrough_size_ == 0) {
+        return {};
+    }
+    if(!passthrough_argv_.empty()) {
+        return {passthrough_argv_.data(), passthrough_size_};
+    }
+    const App *root = this;
+    while(root->parent_ != nullptr) {
+        root = root->parent_;
+    }
+    return {root->argv_ + (root->argc_ - passthrough_size_), passthrough_size_};
+}
+
+CLI11_INLINE std::size_t App::remaining_size(bool recurse) const {
+    auto remaining_options = static_cast<std::size_t>(std::count_if(
+        std::begin(missing_), std::end(missing_), [](const std::pair<detail::Classifier, std::string> &val) {
+            return val.first != detail::Classifier::POSITIONAL_MARK;
+        }));
+    remaining_options += passthrough_size_;
+
+    if(recurse) {
+        for(const App_p &sub : subcommands_) {
+            remaining_options += sub->remaining_size(recurse);
+        }
+    }
+    return remaining_options;
+}
+
+CLI11_INLINE void App::_validate() const {
+    detail::ProfileScope scope(profile_, this, ParsePhase::validate);
+    // count the number of positional only args
+    auto pcount = std::count_if(std::begin(options_), std::end(options_), [](const Option_p &opt) {
+        return opt->get_items_expected_max() >= detail::expected_max_vector_size && !opt->nonpositional();
+    });
+    if(pcount > 1) {
+        auto pcount_req = std::count_if(std::begin(options_), std::end(options_), [](const Option_p &opt) {
+            return opt->get_items_expected_max() >= detail::expected_max_vector_size && !opt->nonpositional() &&
+                   opt->get_required();
+        });
+        if(pcount - pcount_req > 1) {
+            throw InvalidError(name_);
+        }
+    }
+
+    std::size_t nameless_subs{0};
+    for(const App_p &app : subcommands_) {
+        app->_validate();
+        if(app->get_name().empty())
+            ++nameless_subs;
+    }
+
+    if(require_option_min_ > 0) {
+        if(require_option_max_ > 0) {
+            if(require_option_max_ < require_option_min_) {
+                throw(InvalidError("Required min options greater than required max options",
+                                   ExitCodes::InvalidError));
+            }
+        }
+        if(require_option_min_ > (options_.size() + nameless_subs)) {
+            throw(InvalidError("Required min options greater than number of available options",
+                               ExitCodes::InvalidError));
+        }
+    }
+}
+
+CLI11_INLINE void App::_configure() {
+    detail::ProfileScope scope(profile_, this, ParsePhase::configure);
+    if(default_startup == startup_mode::enabled) {
+        disabled_ = false;
+    } else if(default_startup == startup_mode::disabled) {
+        disabled_ = true;
+    }
+    for(const App_p &app : subcommands_) {
+        if(app->has_automatic_name_) {
+            app->name_.clear();
+        }
+        if(app->name_.empty()) {
+            app->fallthrough_ = false;  // make sure fallthrough_ is false to prevent infinite loop
+            app->prefix_command_ = false;
+        }
+        // make sure the parent is set to be this object in preparation for parse
+        app->parent_ = this;
+        app->profile_ = profile_;
+        app->_configure();
+    }
+    _compile_requirements();
+}
+
+namespace detail {
+
+/// Member pointers paired with their ids, sorted by pointer so lookups need no node allocations
+template <typename T> using IdTable = std::vector<std::pair<const T *, std::size_t>>;
+
+/// Build the sorted id table for members, numbering them from first
+template <typename T, typename Pointer>
+IdTable<T> make_id_table(const std::vector<Pointer> &members, std::size_t first) {
+    IdTable<T> ids;
+    ids.reserve(members.size());
+    for(std::size_t i = 0; i < members.size(); ++i)
+        ids.emplace_back(members[i].get(), first + i);
+    std::sort(ids.begin(), ids.end(), [](const std::pair<const T *, std::size_t> &a,
+                                         const std::pair<const T *, std::size_t> &b) {
+        return std::less<const T *>()(a.first, b.first);
+    });
+    return ids;
+}
+
+/// Add the ids of the targets to set, returning false if any of them has no id
+template <typename T> bool insert_ids(IdSet &set, const std::set<T *> &targets, const IdTable<T> &ids) {
+    bool all{true};
+    for(const T *target : targets) {
+        auto found = std::lower_bound(
+            ids.begin(), ids.end(), target, [](const std::pair<const T *, std::size_t> &entry, const T *key) {
+                return std::less<const T *>()(entry.first, key);
+            });
+        if(found == ids.end() || found->first != target)
+            all = false;
+        else
+            set.insert(found->second);
+    }
+    return all;
+}
+
+}  // namespace detail
+
+CLI11_INLINE void App::_compile_requirements() {
+    std::size_t generation = detail::help_generation();
+    if(requirements_.generation == generation && requirements_.options == options_.size() &&
+       requirements_.subcommands == subcommands_.size()) {
+        return;
+    }
+    Requirements table;
+    table.generation = generation;
+    table.options = options_.size();
+    table.subcommands = subcommands_.size();
+    std::size_t members = table.options + table.subcommands;
+    table.needs.resize(members);
+    table.excludes.resize(members);
+    table.outside.assign(members, false);
+
+    auto option_ids = detail::make_id_table<Option>(options_, 0);
+    auto subcommand_ids = detail::make_id_table<App>(subcommands_, table.options);
+
+    for(std::size_t i = 0; i < table.options; ++i) {
+        const Option *opt = options_[i].get();
+        if(opt->get_required())
+            table.required.insert(i);
+        bool inside = detail::insert_ids(table.needs[i], opt->needs_, option_ids);
+        inside = detail::insert_ids(table.excludes[i], opt->excludes_, option_ids) && inside;
+        table.outside[i] = !inside;
+    }
+    for(std::size_t j = 0; j < table.subcommands; ++j) {
+        const App *sub = subcommands_[j].get();
+        std::size_t member = table.options + j;
+        bool inside = detail::insert_ids(table.needs[member], sub->need_options_, option_ids);
+        inside = detail::insert_ids(table.needs[member], sub->need_subcommands_, subcommand_ids) && inside;
+        inside = detail::insert_ids(table.excludes[member], sub->exclude_options_, option_ids) && inside;
+        inside = detail::insert_ids(table.excludes[member], sub->exclude_subcommands_, subcommand_ids) && inside;
+        table.outside[member] = !inside;
+    }
+    requirements_ = std::move(table);
+}
+
+namespace detail {
+
+/// Call task(0) ... task(count - 1) on up to threads threads, including the calling one. Every task runs even if
+/// another one throws; afterwards the exception of the lowest index is rethrown.
+CLI11_INLINE void
+run_concurrently(std::size_t count, std::size_t threads, const std::function<void(std::size_t)> &task) {
+    std::vector<std::exception_ptr> errors(count);
+    std::atomic<std::size_t> next{0};
+    auto work = [&]() {
+        for(std::size_t index = next++; index < count; index = next++) {
+            try {
+                task(index);
+            } catch(...) {
+                errors[index] = std::current_exception();
+            }
+        }
+    };
+    std::vector<std::thread> workers;
+    std::size_t used = (std::min)(threads, count);
+    workers.reserve(used > 0 ? used - 1 : 0);
+    for(std::size_t started = 1; started < used; ++started) {
+        workers.emplace_back(work);
+    }
+    work();
+    for(std::thread &worker : workers) {
+        worker.join();
+    }
+    for(const std::exception_ptr &error : errors) {
+        if(error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+}  // namespace detail
+
+CLI11_INLINE void App::run_callback(bool final_mode, bool suppress_final_callback) {
+    pre_callback();
+    // in the main app if immediate_callback_ is set it runs the main callback before the used subcommands
+    if(!final_mode && parse_complete_callback_) {
+        detail::ProfileScope scope(profile_, this, ParsePhase::user_callback);
+        parse_complete_callback_();
+    }
+    // run the callbacks for the received subcommands
+    if(callback_threads_ > 1) {
+        _run_subcommand_callbacks(suppress_final_callback);
+    } else {
+        for(App *subc : get_subcommands()) {
+            subc->run_callback(true, suppress_final_callback);
+        }
+    }
+    // now run callbacks for option_groups
+    for(auto &subc : subcommands_) {
+        if(subc->name_.empty() && subc->count_all() > 0) {
+            subc->run_callback(true, suppress_final_callback);
+        }
+    }
+
+    // finally run the main callback
+    if(final_callback_ && (parsed_ > 0) && (!suppress_final_callback)) {
+        if(!name_.empty() || count_all() > 0 || parent_ == nullptr) {
+            detail::ProfileScope scope(profile_, this, ParsePhase::user_callback);
+            final_callback_();
+        }
+    }
+}
+
+CLI11_INLINE void App::_run_subcommand_callbacks(bool suppress_final_callback) {
+    std::vector<App *> batch;
+    auto run_batch = [&]() {
+        detail::run_concurrently(batch.size(), callback_threads_, [&](std::size_t index) {
+            batch[index]->run_callback(true, suppress_final_callback);
+        });
+        batch.clear();
+    };
+    for(App *subc : parsed_subcommands_) {
+        // a dependent subcommand waits for the batch before it, and a repeated one must not run alongside itself
+        if(!subc->independent_ || std::find(batch.begin(), batch.end(), subc) != batch.end()) {
+            run_batch();
+        }
+        if(subc->independent_) {
+            batch.push_back(subc);
+        } else {
+            subc->run_callback(true, suppress_final_callback);
+        }
+    }
+    run_batch();
+}
+
+CLI11_INLINE bool App::_valid_subcommand(const std::string &current, bool ignore_used) const {
+    // Don't match if max has been reached - but still check parents
+    if(require_subcommand_max_ != 0 && parsed_subcommands_.size() >= require_subcommand_max_) {
+        return parent_ != nullptr && parent_->_valid_subcommand(current, ignore_used);
+    }
+    auto com = _find_subcommand(current, true, ignore_used);
+    if(com != nullptr) {
+        return true;
+    }
+    // Check parent if exists, else return false
+    return parent_ != nullptr && parent_->_valid_subcommand(current, ignore_used);
+}
+
+CLI11_INLINE detail::Classifier App::_recognize(const std::string &current, bool ignore_used_subcommands) const {
+    std::string dummy1, dummy2;
+
+    if(current == "--")
+        return detail::Classifier::POSITIONAL_MARK;
+    if(_valid_subcommand(current, ignore_used_subcommands))
+        return detail::Classifier::SUBCOMMAND;
+    if(detail::split_long(current, dummy1, dummy2))
+        return detail::Classifier::LONG;
+    if(detail::split_short(current, dummy1, dummy2)) {
+        if(dummy1[0] >= '0' && dummy1[0] <= '9') {
+            if(get_option_no_throw(std::string{'-', dummy1[0]}) == nullptr) {
+                return detail::Classifier::NONE;
+            }
+        }
+        return detail::Classifier::SHORT;
+    }
+    if((allow_windows_style_options_) && (detail::split_windows_style(current, dummy1, dummy2)))
+        return detail::Classifier::WINDOWS_STYLE;
+    if((current == "++") && !name_.empty() && parent_ != nullptr)
+        return detail::Classifier::SUBCOMMAND_TERMINATOR;
+    return detail::Classifier::NONE;
+}
+
+CLI11_INLINE void App::_process_config_file() {
+    detail::ProfileScope scope(profile_, this, ParsePhase::config_file);
+    if(config_ptr_ != nullptr) {
+        bool config_required = config_ptr_->get_required();
+        auto file_given = config_ptr_->count() > 0;
+        auto config_files = config_ptr_->as<std::vector<std::string>>();
+        if(config_files.empty() || config_files.front().empty()) {
+            if(config_required) {
+                throw FileError::Missing("no specified config file");
+            }
+            return;
+        }
+        for(auto rit = config_files.rbegin(); rit != config_files.rend(); ++rit) {
+            const auto &config_file = *rit;
+            auto path_result = detail::check_path(config_file.c_str());
+            if(path_result == detail::path_type::file) {
+                try {
+                    std::vector<ConfigItem> values = config_formatter_->from_file(config_file);
+                    _parse_config(values);
+                    if(!file_given) {
+                        config_ptr_->add_result(config_file);
+                    }
+                } catch(const FileError &) {
+                    if(config_required || file_given)
+                        throw;
+                }
+            } else if(config_required || file_given) {
+                throw FileError::Missing(config_file);
+            }
+        }
+    }
+}
+
+CLI11_INLINE void App::_process_env() {
+    detail::ProfileScope scope(profile_, this, ParsePhase::env);
+    for(const Option_p &opt : options_) {
+        if(opt->count() == 0 && !opt->envname_.empty()) {
+            char *buffer = nullptr;
+            std::string ename_string;
+
+#ifdef _MSC_VER
+            // Windows version
+            std::size_t sz = 0;
+            if(_dupenv_s(&buffer, &sz, opt->envname_.c_str()) == 0 && buffer != nullptr) {
+                ename_string = std::string(buffer);
+                free(buffer);
+            }
+#else
+            // This also works on Windows, but gives a warning
+            buffer = std::getenv(opt->envname_.c_str());
+            if(buffer != nullptr)
+                ename_string = std::string(buffer);
+#endif
+
+            if(!ename_string.empty()) {
+                int result_count{0};
+                _add_input(opt.get(), std::move(ename_string), result_count);
+            }
+        }
+    }
+
+    for(App_p &sub : subcommands_) {
+        if(sub->get_name().empty() || !sub->parse_complete_callback_)
+            sub->_process_env();
+    }
+}
+
+CLI11_INLINE void App::_process_callbacks() {
+    detail::ProfileScope scope(profile_, this, ParsePhase::callbacks);
+    // callbacks may read the results of any option, so every counted flag is finished first
+    _finish_flag_counts();
+
+    for(App_p &sub : subcommands_) {
+        // process the priority option_groups first
+        if(sub->get_name().empty() && sub->parse_complete_callback_) {
+            if(sub->count_all() > 0) {
+                sub->_process_callbacks();
+                sub->run_callback();
+            }
+        }
+    }
+
+    for(const Option_p &opt : options_) {
+        if(opt->count() > 0 && !opt->get_callback_run()) {
+            opt->run_callback();
+        }
+    }
+    for(App_p &sub : subcommands_) {
+        if(!sub->parse_complete_callback_) {
+            sub->_process_callbacks();
+        }
+    }
+}
+
+CLI11_INLINE void
+App::_process_help_flags(bool trigger_help, bool trigger_all_help, std::string search_term) const {
+    const Option *help_ptr = get_help_ptr();
+    const Option *help_all_ptr = get_help_all_ptr();
+
+    if(help_ptr != nullptr && help_ptr->count() > 0) {
+        trigger_help = true;
+        // --help=term searches the help instead of showing all of it
+        for(const std::string &res : help_ptr->results()) {
+            if(_is_help_search_term(res))
+                search_term = res;
+        }
+    }
+    if(help_all_ptr != nullptr && help_all_ptr->count() > 0)
+        trigger_all_help = true;
+
+    // If there were parsed subcommands, call those. First subcommand wins if there are multiple ones.
+    if(!parsed_subcommands_.empty()) {
+        for(const App *sub : parsed_subcommands_)
+            sub->_process_help_flags(trigger_help, trigger_all_help, search_term);
+
+        // Only the final subcommand should call for help. All help wins over help.
+    } else if(trigger_all_help) {
+        throw CallForAllHelp();
+    } else if(trigger_help && !search_term.empty()) {
+        throw CallForHelpSearch(search_term);
+    } else if(trigger_help) {
+        throw CallForHelp();
+    }
+}
+
+CLI11_INLINE std::string App::_requirement_name(std::size_t member) const {
+    if(member < options_.size())
+        return options_[member]->get_name();
+    return subcommands_[member - options_.size()]->get_display_name();
+}
+
+CLI11_INLINE void App::_process_requirements(const Requirements *parent_requirements, std::size_t position) {
+    detail::ProfileScope scope(profile_, this, ParsePhase::requirements);
+    // check excludes
+    bool excluded{false};
+    std::string excluder;
+    // check needs
+    bool missing_needed{false};
+    std::string missing_need;
+    if(parent_requirements != nullptr && !parent_requirements->outside[position]) {
+        std::size_t member = parent_requirements->excludes[position].first_common(parent_requirements->seen);
+        if(member != detail::no_id) {
+            excluded = true;
+            excluder = parent_->_requirement_name(member);
+        }
+        member = parent_requirements->needs[position].first_missing(parent_requirements->seen);
+        if(member != detail::no_id) {
+            missing_needed = true;
+            missing_need = parent_->_requirement_name(member);
+        }
+    } else {
+        for(auto &opt : exclude_options_) {
+            if(opt->count() > 0) {
+                excluded = true;
+                excluder = opt->get_name();
+            }
+        }
+        for(auto &subc : exclude_subcommands_) {
+            if(subc->count_all() > 0) {
+                excluded = true;
+                excluder = subc->get_display_name();
+            }
+        }
+        for(auto &opt : need_options_) {
+            if(opt->count() == 0) {
+                missing_needed = true;
+                missing_need = opt->get_name();
+            }
+        }
+        for(auto &subc : need_subcommands_) {
+            if(subc->count_all() == 0) {
+                missing_needed = true;
+                missing_need = subc->get_display_name();
+            }
+        }
+    }
+    if(excluded) {
+        if(count_all() > 0) {
+            throw ExcludesError(get_display_name(), excluder);
+        }
+        // if we are excluded but didn't receive anything, just return
+        return;
+    }
+    if(missing_needed) {
+        if(count_all() > 0) {
+            throw RequiresError(get_display_name(), missing_need);
+        }
+        // if we missing something but didn't have any options, just return
+        return;
+    }
+
+    _compile_requirements();
+    Requirements &table = requirements_;
+
+    // mark the used options and subcommands
+    table.seen.clear();
+    std::size_t used_options = 0;
+    for(std::size_t i = 0; i < table.options; ++i) {
+        if(options_[i]->count() != 0) {
+            table.seen.insert(i);
+            ++used_options;
+        }
+    }
+    // unnamed subcommands are counted as options from the perspective of an App
+    for(std::size_t j = 0; j < table.subcommands; ++j) {
+        const App *sub = subcommands_[j].get();
+        if(sub->count_all() > 0) {
+            table.seen.insert(table.options + j);
+            if(!sub->disabled_ && sub->name_.empty())
+                ++used_options;
+        }
+    }
+
+    // a single pass over the used options finds the first one with a broken requirement; a required option
+    // that was not used is reported first if it comes before that one
+    std::size_t missing_required = table.required.first_missing(table.seen);
+    for(std::size_t i = table.seen.next(0); i < table.options && i < missing_required; i = table.seen.next(i + 1)) {
+        const Option *opt = options_[i].get();
+        // Requires
+        std::size_t member = table.needs[i].first_missing(table.seen);
+        if(member != detail::no_id)
+            throw RequiresError(opt->get_name(), options_[member]->get_name());
+        if(table.outside[i]) {
+            for(const Option *opt_req : opt->needs_)
+                if(opt_req->count() == 0)
+                    throw RequiresError(opt->get_name(), opt_req->get_name());
+        }
+        // Excludes
+        member = table.excludes[i].first_common(table.seen);
+        if(member != detail::no_id)
+            throw ExcludesError(opt->get_name(), options_[member]->get_name());
+        if(table.outside[i]) {
+            for(const Option *opt_ex : opt->excludes_)
+                if(opt_ex->count() != 0)
+                    throw ExcludesError(opt->get_name(), opt_ex->get_name());
+        }
+    }
+    // Required but empty
+    if(missing_required != detail::no_id) {
+        throw RequiredError(options_[missing_required]->get_name());
+    }
+
+    // check for the required number of subcommands
+    if(require_subcommand_min_ > 0) {
+        auto selected_subcommands = get_subcommands();
+        if(require_subcommand_min_ > selected_subcommands.size())
+            throw RequiredError::Subcommand(require_subcommand_min_);
+    }
+
+    // Max error cannot occur, the extra subcommand will parse as an ExtrasError or a remaining item.
+
+    if(require_option_min_ > used_options || (require_option_max_ > 0 && require_option_max_ < used_options)) {
+        auto option_list = detail::join(options_, [this](const Option_p &ptr) {
+            if(ptr.get() == help_ptr_ || ptr.get() == help_all_ptr_) {
+                return std::string{};
+            }
+            return ptr->get_name(false, true);
+        });
+
+        auto subc_list = get_subcommands([](App *app) { return ((app->get_name().empty()) && (!app->disabled_)); });
+        if(!subc_list.empty()) {
+            option_list += "," + detail::join(subc_list, [](const App *app) { return app->get_display_name(); });
+        }
+        throw RequiredError::Option(require_option_min_, require_option_max_, used_options, option_list);
+    }
+
+    // now process the requirements for subcommands if needed
+    for(std::size_t j = 0; j < table.subcommands; ++j) {
+        App *sub = subcommands_[j].get();
+        bool sub_used = table.seen.contains(table.options + j);
+        if(sub->disabled_)
+            continue;
+        if(sub->name_.empty() && sub->required_ == false) {
+            if(!sub_used) {
+                if(require_option_min_ > 0 && require_option_min_ <= used_options) {
+                    continue;
+                    // if we have met the requirement and there is nothing in this option group skip checking
+                    // requirements
+                }
+                if(require_option_max_ > 0 && used_options >= require_option_min_) {
+                    continue;
+                    // if we have met the requirement and there is nothing in this option group skip checking
+                    // requirements
+                }
+            }
+        }
+        if(sub->count() > 0 || sub->name_.empty()) {
+            sub->_process_requirements(&table, table.options + j);
+        }
+
+        if(sub->required_ && !sub_used) {
+            throw(CLI::RequiredError(sub->get_display_name()));
+        }
+    }
+}
+
+CLI11_INLINE void App::_process() {
+    CLI::FileError fe("ne");
+    bool caught_error{false};
+    try {
+        // the config file might generate a FileError but that should not be processed until later in the process
+        // to allow for help, version and other errors to generate first.
+        _process_config_file();
+        // process env shouldn't throw but no reason to process it if config generated an error
+        _process_env();
+    } catch(const CLI::FileError &fe2) {
+        fe = fe2;
+        caught_error = true;
+    }
+    // callbacks and help_flags can generate exceptions which should take priority over the config file error if one
+    // exists
+    _process_callbacks();
+    _process_help_flags();
+
+    if(caught_error) {
+        throw CLI::FileError(std::move(fe));
+    }
+
+    _process_requirements();
+    _record_final_invocations();
+}
+
+CLI11_INLINE void App::_process_extras() {
+    detail::ProfileScope scope(profile_, this, ParsePhase::extras);
+    if(!(allow_extras_ || prefix_command_)) {
+        std::size_t num_left_over = remaining_size();
+        if(num_left_over > 0) {
+            throw ExtrasError(name_, remaining(false));
+        }
+    }
+
+    for(App_p &sub : subcommands_) {
+        if(sub->count() > 0)
+            sub->_process_extras();
+    }
+}
+
+CLI11_INLINE void App::_process_extras(std::vector<std::string> &args) {
+    detail::ProfileScope scope(profile_, this, ParsePhase::extras);
+    if(!(allow_extras_ || prefix_command_)) {
+        std::size_t num_left_over = remaining_size();
+        if(num_left_over > 0) {
+            args = remaining(false);
+            throw ExtrasError(name_, args);
+        }
+    }
+
+    for(App_p &sub : subcommands_) {
+        if(sub->count() > 0)
+            sub->_process_extras(args);
+    }
+}
+
+CLI11_INLINE void App::increment_parsed() {
+    ++parsed_;
+    for(App_p &sub : subcommands_) {
+        if(sub->get_name().empty())
+            sub->increment_parsed();
+    }
+}
+
+CLI11_INLINE void App::_parse(std::vector<std::string> &args) {
+    if(parent_ == nullptr)
+        parse_args_total_ = args.size();
+    increment_parsed();
+    _trigger_pre_parse(args.size());
+    bool positional_only = false;
+
+    {
+        detail::ProfileScope scope(profile_, this, ParsePhase::parse_args);
+        while(!args.empty()) {
+            if(!_parse_single(args, positional_only)) {
+                break;
+            }
+        }
+    }
+
+    if(parent_ == nullptr) {
+        _process();
+
+        // Throw error if any items are left over (depending on settings)
+        _process_extras(args);
+
+        // Convert missing (pairs) to extras (string only) ready for processing in another app
+        args = remaining_for_passthrough(false);
+    } else if(parse_complete_callback_) {
+        _process_env();
+        _process_callbacks();
+        _process_help_flags();
+        _process_requirements();
+        run_callback(false, true);
+    }
+}
+
+CLI11_INLINE void App::_parse(std::vector<std::string> &&args) {
+    // this can only be called by the top level in which case parent == nullptr by definition
+    // operation is simplified
+    parse_args_total_ = args.size();
+    increment_parsed();
+    _trigger_pre_parse(args.size());
+    bool positional_only = false;
+
+    {
+        detail::ProfileScope scope(profile_, this, ParsePhase::parse_args);
+        while(!args.empty()) {
+            _parse_single(args, positional_only);
+        }
+    }
+    _process();
+
+    // Throw error if any items are left over (depending on settings)
+    _process_extras();
+}
+
+CLI11_INLINE void App::_parse_stream(std::istream &input) {
+    auto values = config_formatter_->from_config(input);
+    if(parse_limits_.max_tokens != 0 && values.size() > parse_limits_.max_tokens)
+        throw LimitError::Tokens(parse_limits_.max_tokens);
+    _parse_config(values);
+    increment_parsed();
+    _trigger_pre_parse(values.size());
+    _process();
+
+    // Throw error if any items are left over (depending on settings)
+    _process_extras();
+}
+
+CLI11_INLINE void App::_parse_config(const std::vector<ConfigItem> &args) {
+    for(const ConfigItem &item : args) {
+        if(!_parse_single_config(item) && allow_config_extras_ == config_extras_mode::error)
+            throw ConfigError::Extras(item.fullname());
+    }
+}
+
+CLI11_INLINE bool App::_parse_single_config(const ConfigItem &item, std::size_t level) {
+    if(level < item.parents.size()) {
+        try {
+            auto subcom = get_subcommand(item.parents.at(level));
+            auto result = subcom->_parse_single_config(item, level + 1);
+
+            return result;
+        } catch(const OptionNotFound &) {
+            return false;
+        }
+    }
+    // check for section open
+    if(item.name == "++") {
+        if(configurable_) {
+            increment_parsed();
+            _trigger_pre_parse(2);
+            if(parent_ != nullptr) {
+                parent_->parsed_subcommands_.push_back(this);
+            }
+        }
+        return true;
+    }
+    // check for section close
+    if(item.name == "--") {
+        if(configurable_) {
+            _process_callbacks();
+            _process_requirements();
+            run_callback();
+        }
+        return true;
+    }
+    Option *op = get_option_no_throw("--" + item.name);
+    if(op == nullptr) {
+        if(item.name.size() == 1) {
+            op = get_option_no_throw("-" + item.name);
+        }
+    }
+    if(op == nullptr) {
+        op = get_option_no_throw(item.name);
+    }
+    if(op == nullptr) {
+        // If the option was not present
+        if(get_allow_config_extras() == config_extras_mode::capture)
+            // Should we worry about classifying the extras properly?
+            missing_.emplace_back(detail::Classifier::NONE, item.fullname());
+        return false;
+    }
+
+    if(!op->get_configurable()) {
+        if(get_allow_config_extras() == config_extras_mode::ignore_all) {
+            return false;
+        }
+        throw ConfigError::NotConfigurable(item.fullname());
+    }
+
+    if(op->empty()) {
+        // Flag parsing
+        if(op->get_expected_min() == 0) {
+            auto res = config_formatter_->to_flag(item);
+            res = op->get_flag_value(item.name, res);
+
+            int result_count{0};
+            _add_input(op, std::move(res), result_count);
+
+        } else {
+            for(const std::string &input : item.inputs) {
+                _check_input_depth(op, input);
+            }
+            op->add_result(item.inputs);
+            _check_input_values(op);
+            op->run_callback();
+        }
+    }
+
+    return true;
+}
+
+CLI11_INLINE bool App::_parse_single(std::vector<std::string> &args, bool &positional_only) {
+    bool retval = true;
+    detail::Classifier classifier = positional_only ? detail::Classifier::NONE : _recognize(args.back());
+    switch(classifier) {
+    case detail::Classifier::POSITIONAL_MARK:
+        args.pop_back();
+        positional_only = true;
+        if((!_has_remaining_positionals()) && (parent_ != nullptr)) {
+            retval = false;
+        } else {
+            _move_to_missing(classifier, "--");
+        }
+        break;
+    case detail::Classifier::SUBCOMMAND_TERMINATOR:
+        // treat this like a positional mark if in the parent app
+        args.pop_back();
+        retval = false;
+        break;
+    case detail::Classifier::SUBCOMMAND:
+        retval = _parse_subcommand(args);
+        break;
+    case detail::Classifier::LONG:
+    case detail::Classifier::SHORT:
+    case detail::Classifier::WINDOWS_STYLE:
+        // If already parsed a subcommand, don't accept options_
+        _parse_arg(args, classifier);
+        break;
+    case detail::Classifier::NONE:
+        // Probably a positional or something for a parent (sub)command
+        retval = _parse_positional(args, false);
+        if(retval && positionals_at_end_) {
+            positional_only = true;
+        }
+        break;
+        // LCOV_EXCL_START
+    default:
+        throw HorribleError("unrecognized classifier (you should not see this!)");
+        // LCOV_EXCL_STOP
+    }
+    return retval;
+}
+
+CLI11_INLINE std::size_t App::_count_remaining_positionals(bool required_only) const {
+    std::size_t retval = 0;
+    for(const Option_p &opt : options_) {
+        if(opt->get_positional() && (!required_only || opt->get_required())) {
+            if(opt->get_items_expected_min() > 0 &&
+               static_cast<int>(opt->count()) < opt->get_items_expected_min()) {
+                retval += static_cast<std::size_t>(opt->get_items_expected_min()) - opt->count();
+            }
+        }
+    }
+    return retval;
+}
+
+CLI11_INLINE bool App::_has_remaining_positionals() const {
+    for(const Option_p &opt : options_) {
+        if(opt->get_positional() && ((static_cast<int>(opt->count()) < opt->get_items_expected_min()))) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+CLI11_INLINE bool App::_parse_positional(std::vector<std::string> &args, bool haltOnSubcommand) {
+
+    const std::string &positional = args.back();
+
+    if(positionals_at_end_) {
+        // deal with the case of required arguments at the end which should take precedence over other arguments
+        auto arg_rem = args.size();
+        auto remreq = _count_remaining_positionals(true);
+        if(arg_rem <= remreq) {
+            for(const Option_p &opt : options_) {
+                if(opt->get_positional() && opt->required_) {
+                    if(static_cast<int>(opt->count()) < opt->get_items_expected_min()) {
+                        if(validate_positionals_) {
+                            std::string pos = positional;
+                            pos = opt->_validate(pos, 0);
+                            if(!pos.empty()) {
+                                continue;
+                            }
+                        }
+                        parse_order_.push_back(opt.get(), _arg_position(args));
+                        int result_count = 0;
+                        _add_input(opt.get(), std::move(args.back()), result_count);
+                        args.pop_back();
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+    for(const Option_p &opt : options_) {
+        // Eat options, one by one, until done
+        if(opt->get_positional() &&
+           (static_cast<int>(opt->count()) < opt->get_items_expected_min() || opt->get_allow_extra_args())) {
+            if(validate_positionals_) {
+                std::string pos = positional;
+                pos = opt->_validate(pos, 0);
+                if(!pos.empty()) {
+                    continue;
+                }
+            }
+            parse_order_.push_back(opt.get(), _arg_position(args));
+            int result_count = 0;
+            _add_input(opt.get(), std::move(args.back()), result_count);
+            args.pop_back();
+            return true;
+        }
+    }
+
+    for(auto &subc : subcommands_) {
+        if((subc->name_.empty()) && (!subc->disabled_)) {
+            if(subc->_parse_positional(args, false)) {
+                if(!subc->pre_parse_called_) {
+                    subc->_trigger_pre_parse(args.size());
+                }
+                return true;
+            }
+        }
+    }
+    // let the parent deal with it if possible
+    if(parent_ != nullptr && fallthrough_)
+        return _get_fallthrough_parent()->_parse_positional(args, static_cast<bool>(parse_complete_callback_));
+
+    /// Try to find a local subcommand that is repeated
+    auto com = _find_subcommand(args.back(), true, false);
+    if(com != nullptr && (require_subcommand_max_ == 0 || require_subcommand_max_ > parsed_subcommands_.size())) {
+        if(haltOnSubcommand) {
+            return false;
+        }
+        _check_subcommand_depth(com);
+        args.pop_back();
+        com->_parse(args);
+        return true;
+    }
+    /// now try one last gasp at subcommands that have been executed before, go to root app and try to find a
+    /// subcommand in a broader way, if one exists let the parent deal with it
+    auto parent_app = (parent_ != nullptr) ? _get_fallthrough_parent() : this;
+    com = parent_app->_find_subcommand(args.back(), true, false);
+    if(com != nullptr && (com->parent_->require_subcommand_max_ == 0 ||
+                          com->parent_->require_subcommand_max_ > com->parent_->parsed_subcommands_.size())) {
+        return false;
+    }
+
+    if(positionals_at_end_) {
+        throw CLI::ExtrasError(name_, args);
+    }
+    /// If this is an option group don't deal with it
+    if(parent_ != nullptr && name_.empty()) {
+        return false;
+    }
+    if(prefix_command_) {
+        _pass_through(args);
+        return true;
+    }
+    /// We are out of other options this goes to missing
+    _move_to_missing(detail::Classifier::NONE, positional);
+    args.pop_back();
+
+    return true;
+}
+
+CLI11_INLINE App *App::_find_subcommand(const std::string &subc_name,
+                                        bool ignore_disabled,
+                                        bool ignore_used) const noexcept {
+    for(const App_p &com : subcommands_) {
+        if(com->disabled_ && ignore_disabled)
+            continue;
+        if(com->get_name().empty()) {
+            auto subc = com->_find_subcommand(subc_name, ignore_disabled, ignore_used);
+            if(subc != nullptr) {
+                return subc;
+            }
+        }
+        if(com->check_name(subc_name)) {
+            if((!*com) || !ignore_used)
+                return com.get();
+        }
+    }
+    return nullptr;
+}
+
+CLI11_INLINE bool App::_parse_subcommand(std::vector<std::string> &args) {
+    if(_count_remaining_positionals(/* required */ true) > 0) {
+        _parse_positional(args, false);
+        return true;
+    }
+    auto com = _find_subcommand(args.back(), true, true);
+    if(com != nullptr) {
+        _check_subcommand_depth(com);
+        args.pop_back();
+        if(!com->silent_) {
+            parsed_subcommands_.push_back(com);
+        }
+        com->_parse(args);
+        auto parent_app = com->parent_;
+        while(parent_app != this) {
+            parent_app->_trigger_pre_parse(args.size());
+            if(!com->silent_) {
+                parent_app->parsed_subcommands_.push_back(com);
+            }
+            parent_app = parent_app->parent_;
+        }
+        return true;
+    }
+
+    if(parent_ == nullptr)
+        throw HorribleError("Subcommand " + args.back() + " missing");
+    return false;
+}
+
+CLI11_INLINE bool App::_parse_arg(std::vector<std::string> &args, detail::Classifier current_type) {
+    detail::ProfileScope scope(profile_, this, ParsePhase::parse_arg);
+
+    const std::string &current = args.back();
+
+    std::string arg_name;
+    std::string value;
+    std::string rest;
+
+    switch(current_type) {
+    case detail::Classifier::LONG:
+        if(!detail::split_long(current, arg_name, value))
+            throw HorribleError("Long parsed but missing (you should not see this):" + args.back());
+        break;
+    case detail::Classifier::SHORT:
+        if(!detail::split_short(current, arg_name, rest))
+            throw HorribleError("Short parsed but missing! You should not see this");
+        break;
+    case detail::Classifier::WINDOWS_STYLE:
+        if(!detail::split_windows_style(current, arg_name, value))
+            throw HorribleError("windows option parsed but missing! You should not see this");
+        break;
+    case detail::Classifier::SUBCOMMAND:
+    case detail::Classifier::SUBCOMMAND_TERMINATOR:
+    case detail::Classifier::POSITIONAL_MARK:
+    case detail::Classifier::NONE:
+    default:
+        throw HorribleError("parsing got called with invalid option! You should not see this");
+    }
+
+    auto op_ptr =
+        std::find_if(std::begin(options_), std::end(options_), [&arg_name, current_type](const Option_p &opt) {
+            if(current_type == detail::Classifier::LONG)
+                return opt->check_lname(arg_name);
+            if(current_type == detail::Classifier::SHORT)
+                return opt->check_sname(arg_name);
+            // this will only get called for detail::Classifier::WINDOWS_STYLE
+            return opt->check_lname(arg_name) || opt->check_sname(arg_name);
+        });
+
+    // Option not found
+    if(op_ptr == std::end(options_)) {
+        for(auto &subc : subcommands_) {
+            if(subc->name_.empty() && !subc->disabled_) {
+                if(subc->_parse_arg(args, current_type)) {
+                    if(!subc->pre_parse_called_) {
+                        subc->_trigger_pre_parse(args.size());
+                    }
+                    return true;
+                }
+            }
+        }
+        // If a subcommand, try the master command
+        if(parent_ != nullptr && fallthrough_)
+            return _get_fallthrough_parent()->_parse_arg(args, current_type);
+        // don't capture missing if this is a nameless subcommand
+        if(parent_ != nullptr && name_.empty()) {
+            return false;
+        }
+        // Otherwise, add to missing
+        _move_to_missing(current_type, current);
+        args.pop_back();
+        return true;
+    }
+
+    std::size_t arg_position = _arg_position(args);
+    args.pop_back();
+
+    // Get a reference to the pointer to make syntax bearable
+    Option_p &op = *op_ptr;
+    /// if we require a separator add it here
+    if(op->get_inject_separator()) {
+        if(!op->results().empty() && !op->results().back().empty()) {
+            op->add_result(std::string{});
+        }
+    }
+    int min_num = (std::min)(op->get_type_size_min(), op->get_items_expected_min());
+    int max_num = op->get_items_expected_max();
+    // check container like options to limit the argument size to a single type if the allow_extra_flags argument is
+    // set. 16 is somewhat arbitrary (needs to be at least 4)
+    if(max_num >= detail::expected_max_vector_size / 16 && !op->get_allow_extra_args()) {
+        auto tmax = op->get_type_size_max();
+        max_num = detail::checked_multiply(tmax, op->get_expected_min()) ? tmax : detail::expected_max_vector_size;
+    }
+    // Make sure we always eat the minimum for unlimited vectors
+    int collected = 0;     // total number of arguments collected
+    int result_count = 0;  // local variable for number of results in a single arg string
+    // deal with purely flag like things
+    if(max_num == 0) {
+        auto res = op->get_flag_value(arg_name, std::move(value));
+        _add_input(op.get(), std::move(res), result_count);
+        parse_order_.push_back(op.get(), arg_position);
+    } else if(!value.empty()) {  // --this=value
+        _add_input(op.get(), std::move(value), result_count);
+        parse_order_.push_back(op.get(), arg_position);
+        collected += result_count;
+        // -Trest
+    } else if(!rest.empty()) {
+        _add_input(op.get(), std::move(rest), result_count);
+        parse_order_.push_back(op.get(), arg_position);
+        rest = "";
+        collected += result_count;
+    }
+
+    // gather the minimum number of arguments
+    while(min_num > collected && !args.empty()) {
+        parse_order_.push_back(op.get(), _arg_position(args));
+        _add_input(op.get(), std::move(args.back()), result_count);
+        args.pop_back();
+        collected += result_count;
+    }
+
+    if(min_num > collected) {  // if we have run out of arguments and the minimum was not met
+        throw ArgumentMismatch::TypedAtLeast(op->get_name(), min_num, op->get_type_name());
+    }
+
+    if(max_num > collected || op->get_allow_extra_args()) {  // we allow optional arguments
+        auto remreqpos = _count_remaining_positionals(true);
+        // we have met the minimum now optionally check up to the maximum
+        while((collected < max_num || op->get_allow_extra_args()) && !args.empty() &&
+              _recognize(args.back(), false) == detail::Classifier::NONE) {
+            // If any required positionals remain, don't keep eating
+            if(remreqpos >= args.size()) {
+                break;
+            }
+
+            parse_order_.push_back(op.get(), _arg_position(args));
+            _add_input(op.get(), std::move(args.back()), result_count);
+            args.pop_back();
+            collected += result_count;
+        }
+
+        // Allow -- to end an unlimited list and "eat" it
+        if(!args.empty() && _recognize(args.back()) == detail::Classifier::POSITIONAL_MARK)
+            args.pop_back();
+        // optional flag that didn't receive anything now get the default value
+        if(min_num == 0 && max_num > 0 && collected == 0) {
+            auto res = op->get_flag_value(arg_name, std::string{});
+            _add_input(op.get(), std::move(res), result_count);
+            parse_order_.push_back(op.get(), arg_position);
+        }
+    }
+
+    // if we only partially completed a type then add an empty string for later processing
+    if(min_num > 0 && op->get_type_size_max() != min_num && (collected % op->get_type_size_max()) != 0) {
+        op->add_result(std::string{});
+    }
+
+    if(!rest.empty()) {
+        rest = "-" + rest;
+        args.push_back(rest);
+    }
+    return true;
+}
+
+CLI11_INLINE void App::_add_input(Option *op, std::string &&value, int &results_added) {
+    _check_input_depth(op, value);
+    op->add_result(std::move(value), results_added);
+    _check_input_values(op);
+}
+
+CLI11_INLINE void App::_check_input_depth(const Option *op, const std::string &value) const {
+    if(parse_limits_.max_depth != 0 && !value.empty() && value.front() == '[' &&
+       detail::bracket_depth(value) > parse_limits_.max_depth) {
+        throw LimitError::Depth(op->get_name(), parse_limits_.max_depth);
+    }
+}
+
+CLI11_INLINE void App::_check_input_values(const Option *op) const {
+    if(parse_limits_.max_values != 0 && op->count() > parse_limits_.max_values) {
+        throw LimitError::Values(op->get_name(), parse_limits_.max_values);
+    }
+}
+
+CLI11_INLINE void App::_check_input_size(const std::vector<std::string> &args) const {
+    const ParseLimits &limits = parse_limits_;
+    if(limits.max_tokens != 0 && args.size() > limits.max_tokens) {
+        throw LimitError::Tokens(limits.max_tokens);
+    }
+    if(limits.max_bytes != 0) {
+        std::size_t bytes{0};
+        for(const std::string &arg : args) {
+            if((bytes += arg.size()) > limits.max_bytes) {
+                throw LimitError::Bytes(limits.max_bytes);
+            }
+        }
+    }
+}
+
+CLI11_INLINE void App::_check_subcommand_depth(const App *com) const {
+    if(parse_limits_.max_depth == 0) {
+        return;
+    }
+    std::size_t depth{0};
+    for(const App *app = com; app->parent_ != nullptr; app = app->parent_) {
+        if(!app->name_.empty()) {
+            ++depth;
+        }
+    }
+    if(depth > parse_limits_.max_depth) {
+        throw LimitError::Depth(com->get_display_name(), parse_limits_.max_depth);
+    }
+}
+
+CLI11_INLINE void App::_pass_through(std::vector<std::string> &args) {
+    const App *root = this;
+    while(root->parent_ != nullptr) {
+        root = root->parent_;
+    }
+    passthrough_size_ = args.size();
+    // args holds the end of argv in reverse, unless it came from elsewhere or the last value was split from an option
+    if(root->argv_ == nullptr || args.size() >= root->argc_ ||
+       args.back() != root->argv_[root->argc_ - args.size()]) {
+        passthrough_values_.assign(std::make_move_iterator(args.rbegin()), std::make_move_iterator(args.rend()));
+        passthrough_argv_.clear();
+        passthrough_argv_.reserve(passthrough_values_.size() + 1);
+        for(const std::string &value : passthrough_values_) {
+            passthrough_argv_.push_back(value.c_str());
+        }
+        passthrough_argv_.push_back(nullptr);
+    }
+    args.clear();
+}
+
+CLI11_INLINE void App::_set_profile(const std::shared_ptr<ParseProfile> &profile) {
+    profile_ = profile;
+    for(const App_p &subc : subcommands_) {
+        subc->_set_profile(profile);
+    }
+}
+
+CLI11_INLINE void App::_trigger_pre_parse(std::size_t remaining_args) {
+    if(!pre_parse_called_) {
+        pre_parse_called_ = true;
+        if(pre_parse_callback_) {
+            detail::ProfileScope scope(profile_, this, ParsePhase::user_callback);
+            pre_parse_callback_(remaining_args);
+        }
+    } else if(record_invocations_) {
+        if(!name_.empty()) {
+            _record_invocation(true);
+        }
+    } else if(immediate_callback_) {
+        if(!name_.empty()) {
+            auto pcnt = parsed_;
+            auto extras = std::move(missing_);
+            clear();
+            parsed_ = pcnt;
+            pre_parse_called_ = true;
+            missing_ = std::move(extras);
+        }
+    }
+    if(parent_ != nullptr) {
+        const App *root = this;
+        while(root->parent_ != nullptr) {
+            root = root->parent_;
+        }
+        invocation_position_ = root->parse_args_total_ - remaining_args;
+    }
+}
+
+CLI11_INLINE void App::_record_invocation(bool reset) {
+    InvocationRecord record(invocation_position_);
+    _add_to_record(record, reset);
+    invocations_.push_back(std::move(record));
+    if(reset) {
+        // only the subcommands used by this invocation hold anything to clear
+        for(App *sub : parsed_subcommands_) {
+            sub->clear();
+        }
+        parsed_subcommands_.clear();
+    }
+}
+
+CLI11_INLINE void App::_finish_flag_counts() {
+    for(const Option_p &opt : options_) {
+        opt->_finish_flag_count();
+    }
+    for(const App_p &sub : subcommands_) {
+        sub->_finish_flag_counts();
+    }
+}
+
+CLI11_INLINE void App::_add_to_record(InvocationRecord &record, bool reset) {
+    for(const Option_p &opt : options_) {
+        if(opt->count() == 0) {
+            continue;
+        }
+        opt->_expand_flag_results();
+        if(reset) {
+            record.add(opt.get(), opt->results_);
+            opt->clear();
+        } else {
+            std::vector<std::string> values = opt->results();
+            record.add(opt.get(), values);
+        }
+    }
+    for(const App_p &sub : subcommands_) {
+        if(sub->name_.empty()) {
+            sub->_add_to_record(record, reset);
+        }
+    }
+    if(reset) {
+        parse_order_.clear();
+        if(name_.empty()) {
+            parsed_ = 0;
+            pre_parse_called_ = false;
+        }
+    }
+}
+
+CLI11_INLINE void App::_record_final_invocations() {
+    for(const App_p &sub : subcommands_) {
+        if(sub->record_invocations_ && sub->parsed_ > sub->invocations_.size()) {
+            sub->_record_invocation(false);
+        }
+        sub->_record_final_invocations();
+    }
+}
+
+CLI11_INLINE std::size_t App::_arg_position(const std::vector<std::string> &args) const {
+    const App *root = this;
+    while(root->parent_ != nullptr) {
+        root = root->parent_;
+    }
+    return root->parse_args_total_ - args.size();
+}
+
+CLI11_INLINE App *App::_get_fallthrough_parent() {
+    if(parent_ == nullptr) {
+        throw(HorribleError("No Valid parent"));
+    }
+    auto fallthrough_parent = parent_;
+    while((fallthrough_parent->parent_ != nullptr) && (fallthrough_parent->get_name().empty())) {
+        fallthrough_parent = fallthrough_parent->parent_;
+    }
+    return fallthrough_parent;
+}
+
+CLI11_INLINE const std::string &App::_compare_subcommand_names(const App &subcom, const App &base) const {
+    static const std::string estring;
+    if(subcom.disabled_) {
+        return estring;
+    }
+    for(auto &subc : base.subcommands_) {
+        if(subc.get() != &subcom) {
+            if(subc->disabled_) {
+                continue;
+            }
+            if(!subcom.get_name().empty()) {
+                if(subc->check_name(subcom.get_name())) {
+                    return subcom.get_name();
+                }
+            }
+            if(!subc->get_name().empty()) {
+                if(subcom.check_name(subc->get_name())) {
+                    return subc->get_name();
+                }
+            }
+            for(const auto &les : subcom.aliases_) {
+                if(subc->check_name(les)) {
+                    return les;
+                }
+            }
+            // this loop is needed in case of ignore_underscore or ignore_case on one but not the other
+            for(const auto &les : subc->aliases_) {
+                if(subcom.check_name(les)) {
+                    return les;
+                }
+            }
+            // if the subcommand is an option group we need to check deeper
+            if(subc->get_name().empty()) {
+                auto &cmpres = _compare_subcommand_names(subcom, *subc);
+                if(!cmpres.empty()) {
+                    return cmpres;
+                }
+            }
+            // if the test subcommand is an option group we need to check deeper
+            if(subcom.get_name().empty()) {
+                auto &cmpres = _compare_subcommand_names(*subc, subcom);
+                if(!cmpres.empty()) {
+                    return cmpres;
+                }
+            }
+        }
+    }
+    return estring;
+}
+
+CLI11_INLINE void App::_move_to_missing(detail::Classifier val_type, const std::string &val) {
+    if(allow_extras_ || subcommands_.empty()) {
+        missing_.emplace_back(val_type, val);
+        return;
+    }
+    // allow extra arguments to be places in an option group if it is allowed there
+    for(auto &subc : subcommands_) {
+        if(subc->name_.empty() && subc->allow_extras_) {
+            subc->missing_.emplace_back(val_type, val);
+            return;
+        }
+    }
+    // if we haven't found any place to put them yet put them in missing
+    missing_.emplace_back(val_type, val);
+}
+
+CLI11_INLINE void App::_move_option(Option *opt, App *app) {
+    if(opt == nullptr) {
+        throw OptionNotFound("the option is NULL");
+    }
+    // verify that the give app is actually a subcommand
+    bool found = false;
+    for(auto &subc : subcommands_) {
+        if(app == subc.get()) {
+            found = true;
+        }
+    }
+    if(!found) {
+        throw OptionNotFound("The Given app is not a subcommand");
+    }
+
+    if((help_ptr_ == opt) || (help_all_ptr_ == opt))
+        throw OptionAlreadyAdded("cannot move help options");
+
+    if(config_ptr_ == opt)
+        throw OptionAlreadyAdded("cannot move config file options");
+
+    auto iterator =
+        std::find_if(std::begin(options_), std::end(options_), [opt](const Option_p &v) { return v.get() == opt; });
+    if(iterator != std::end(options_)) {
+        const auto &opt_p = *iterator;
+        if(std::find_if(std::begin(app->options_), std::end(app->options_), [&opt_p](const Option_p &v) {
+               return (*v == *opt_p);
+           }) == std::end(app->options_)) {
+            // only erase after the insertion was successful
+            app->options_.push_back(std::move(*iterator));
+            options_.erase(iterator);
+            detail::help_changed();
+        } else {
+            throw OptionAlreadyAdded("option was not located: " + opt->get_name());
+        }
+    } else {
+        throw OptionNotFound("could not locate the given Option");
+    }
+}
+
+CLI11_INLINE Option_group::Option_group(std::string group_description, std::string group_name, App *parent)
+    : App(std::move(group_description), "", parent) {
+    group(group_name);
+    // option groups should have automatic fallthrough
+}
+
+CLI11_INLINE Option *Option_group::add_option(Option *opt) {
+    if(get_parent() == nullptr) {
+        throw OptionNotFound("Unable to locate the specified option");
+    }
+    get_parent()->_move_option(opt, this);
+    return opt;
+}
+
+CLI11_INLINE App *Option_group::add_subcommand(App *subcom) {
+    App_p subc = subcom->get_parent()->get_subcommand_ptr(subcom);
+    subc->get_parent()->remove_subcommand(subcom);
+    add_subcommand(std::move(subc));
+    return subcom;
+}
+
+CLI11_INLINE void TriggerOn(App *trigger_app, App *app_to_enable) {
+    app_to_enable->enabled_by_default(false);
+    app_to_enable->disabled_by_default();
+    trigger_app->preparse_callback([app_to_enable](std::size_t) { app_to_enable->disabled(false); });
+}
+
+CLI11_INLINE void TriggerOn(App *trigger_app, std::vector<App *> apps_to_enable) {
+    for(auto &app : apps_to_enable) {
+        app->enabled_by_default(false);
+        app->disabled_by_default();
+    }
+
+    trigger_app->preparse_callback([apps_to_enable](std::size_t) {
+        for(auto &app : apps_to_enable) {
+            app->disabled(false);
+        }
+    });
+}
+
+CLI11_INLINE void TriggerOff(App *trigger_app, App *app_to_enable) {
+    app_to_enable->disabled_by_default(false);
+    app_to_enable->enabled_by_default();
+    trigger_app->preparse_callback([app_to_enable](std::size_t) { app_to_enable->disabled(); });
+}
+
+CLI11_INLINE void TriggerOff(App *trigger_app, std::vector<App *> apps_to_enable) {
+    for(auto &app : apps_to_enable) {
+        app->disabled_by_default(false);
+        app->enabled_by_default();
+    }
+
+    trigger_app->preparse_callback([apps_to_enable](std::size_t) {
+        for(auto &app : apps_to_enable) {
+            app->disabled();
+        }
+    });
+}
+
+CLI11_INLINE void deprecate_option(Option *opt, const std::string &replacement) {
+    Validator deprecate_warning{[opt, replacement](std::string &) {
+                                    std::cout << opt->get_name() << " is deprecated please use '" << replacement
+                                              << "' instead\n";
+                                    return std::string();
+                                },
+                                "DEPRECATED"};
+    deprecate_warning.application_index(0);
+    opt->check(deprecate_warning);
+    if(!replacement.empty()) {
+        opt->description(opt->get_description() + " DEPRECATED: please use '" + replacement + "' instead");
+    }
+}
+
+CLI11_INLINE void deprecate_option(App *app, const std::string &option_name, const std::string &replacement) {
+    auto opt = app->get_option(option_name);
+    deprecate_option(opt, replacement);
+}
+
+CLI11_INLINE void deprecate_option(App &app, const std::string &option_name, const std::string &replacement) {
+    auto opt = app.get_option(option_name);
+    deprecate_option(opt, replacement);
+}
+
+CLI11_INLINE void retire_option(App *app, Option *opt) {
+    App temp;
+    auto option_copy = temp.add_option(opt->get_name(false, true))
+                           ->type_size(opt->get_type_size_min(), opt->get_type_size_max())
+                           ->expected(opt->get_expected_min(), opt->get_expected_max())
+                           ->allow_extra_args(opt->get_allow_extra_args());
+
+    app->remove_option(opt);
+    auto opt2 = app->add_option(option_copy->get_name(false, true), "option has been retired and has no effect")
+                    ->type_name("RETIRED")
+                    ->default_str("RETIRED")
+                    ->type_size(option_copy->get_type_size_min(), option_copy->get_type_size_max())
+                    ->expected(option_copy->get_expected_min(), option_copy->get_expected_max())
+                    ->allow_extra_args(option_copy->get_allow_extra_args());
+
+    Validator retired_warning{[opt2](std::string &) {
+                                  std::cout << "WARNING " << opt2->get_name() << " is retired and has no effect\n";
+                                  return std::string();
+                              },
+                              ""};
+    retired_warning.application_index(0);
+    opt2->check(retired_warning);
+}
+
+CLI11_INLINE void retire_option(App *app, const std::string &option_name) {
+
+    auto opt = app->get_option_no_throw(option_name);
+    if(opt != nullptr) {
+        retire_option(app, opt);
+        return;
+    }
+    auto opt2 = app->add_option(option_name, "option has been retired and has no effect")
+                    ->type_name("RETIRED")
+                    ->expected(0, 1)
+                    ->default_str("RETIRED");
+    Validator retired_warning{[opt2](std::string &) {
+                                  std::cout << "WARNING " << opt2->get_name() << " is retired and has no effect\n";
+                                  return std::string();
+                              },
+                              ""};
+    retired_warning.application_index(0);
+    opt2->check(retired_warning);
+}
+
+namespace FailureMessage {
+
+CLI11_INLINE std::string simple(const App *app, const Error &e) {
+    std::string header = std::string(e.what()) + "\n";
+    std::vector<std::string> names;
+
+    // Collect names
+    if(app->get_help_ptr() != nullptr)
+        names.push_back(app->get_help_ptr()->get_name());
+
+    if(app->get_help_all_ptr() != nullptr)
+        names.push_back(app->get_help_all_ptr()->get_name());
+
+    // If any names found, suggest those
+    if(!names.empty())
+        header += "Run with " + detail::join(names, " or ") + " for more information.\n";
+
+    return header;
+}
+
+CLI11_INLINE std::string help(const App *app, const Error &e) {
+    std::string header = std::string("ERROR: ") + e.get_name() + ": " + e.what() + "\n";
+    header += app->help();
+    return header;
+}
+
+}  // namespace FailureMessage
+
+// [CLI11:app_inl_hpp:end]
+}  // namespace CLI
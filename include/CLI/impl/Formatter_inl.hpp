@@ -0,0 +1,410 @@
+// Copyright (c) 2017-2021, University of Cincinnati, developed by Henry Schreiner
+// under NSF AWARD 1414736 and by the respective contributors.
+// All rights reserved.
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+// This include is only needed for IDEs to discover symbols
+#include "../Formatter.hpp"
+
+// [CLI11:public_includes:set]
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+// [CLI11:public_includes:end]
+
+namespace CLI {
+// [CLI11:formatter_inl_hpp:verbatim]
+CLI11_INLINE std::string
+Formatter::make_group(std::string group, bool is_positional, std::vector<const Option *> opts) const {
+    std::ostringstream out;
+    _write_group(out, group, is_positional, opts);
+    return out.str();
+}
+
+CLI11_INLINE std::string Formatter::make_positionals(const App *app) const {
+    std::ostringstream out;
+    _write_positionals(out, app);
+    return out.str();
+}
+
+CLI11_INLINE std::string Formatter::make_groups(const App *app, AppFormatMode mode) const {
+    std::ostringstream out;
+    _write_groups(out, app, mode);
+    return out.str();
+}
+
+
+CLI11_INLINE std::string Formatter::make_description(const App *app) const {
+    std::string desc = app->get_description();
+    auto min_options = app->get_require_option_min();
+    auto max_options = app->get_require_option_max();
+    if(app->get_required()) {
+        desc += " REQUIRED ";
+    }
+    if((max_options == min_options) && (min_options > 0)) {
+        if(min_options == 1) {
+            desc += " \n[Exactly 1 of the following options is required]";
+        } else {
+            desc += " \n[Exactly " + std::to_string(min_options) + "options from the following list are required]";
+        }
+    } else if(max_options > 0) {
+        if(min_options > 0) {
+            desc += " \n[Between " + std::to_string(min_options) + " and " + std::to_string(max_options) +
+                    " of the follow options are required]";
+        } else {
+            desc += " \n[At most " + std::to_string(max_options) + " of the following options are allowed]";
+        }
+    } else if(min_options > 0) {
+        desc += " \n[At least " + std::to_string(min_options) + " of the following options are required]";
+    }
+    return (!desc.empty()) ? desc + "\n" : std::string{};
+}
+
+CLI11_INLINE std::string Formatter::make_usage(const App *app, std::string name) const {
+    std::stringstream out;
+
+    out << get_label("Usage") << ":" << (name.empty() ? "" : " ") << name;
+
+    auto options = app->options_view();
+
+    // Print an Options badge if any options exist
+    if(std::any_of(options.begin(), options.end(), [](const Option *opt) { return opt->nonpositional(); }))
+        out << " [" << get_label("OPTIONS") << "]";
+
+    // Positionals need to be listed here
+    for(const Option *opt : options) {
+        if(opt->get_positional())
+            out << " " << make_option_usage(opt);
+    }
+
+    // Add a marker if subcommands are expected or optional
+    auto subcommands = app->subcommands_view();
+    if(std::any_of(subcommands.begin(), subcommands.end(), [](const CLI::App *subc) {
+           return ((!subc->get_disabled()) && (!subc->get_name().empty()));
+       })) {
+        out << " " << (app->get_require_subcommand_min() == 0 ? "[" : "")
+            << get_label(app->get_require_subcommand_max() < 2 || app->get_require_subcommand_min() > 1 ? "SUBCOMMAND"
+                                                                                                        : "SUBCOMMANDS")
+            << (app->get_require_subcommand_min() == 0 ? "]" : "");
+    }
+
+    out << std::endl;
+
+    return out.str();
+}
+
+CLI11_INLINE std::string Formatter::make_footer(const App *app) const {
+    std::string footer = app->get_footer();
+    if(footer.empty()) {
+        return std::string{};
+    }
+    return footer + "\n";
+}
+
+CLI11_INLINE std::string Formatter::make_help(const App *app, std::string name, AppFormatMode mode) const {
+    std::ostringstream out;
+    _write_help(out, app, name, mode);
+    return out.str();
+}
+
+
+CLI11_INLINE std::string FormatterBase::make_search(const App * /*app*/,
+                                                   std::string /*name*/,
+                                                   const std::string &term,
+                                                   const std::vector<HelpMatch> &matches) const {
+    std::stringstream out;
+    if(matches.empty()) {
+        out << get_label("No help matches") << " \"" << term << "\"\n";
+    }
+    for(const HelpMatch &match : matches) {
+        if(match.option != nullptr) {
+            detail::format_help(
+                out, match.option->get_name(false, true), match.option->get_description(), column_width_);
+        } else {
+            detail::format_help(
+                out, match.subcommand->get_display_name(true), match.subcommand->get_description(), column_width_);
+        }
+    }
+    return out.str();
+}
+
+CLI11_INLINE std::string Formatter::make_search(const App *app,
+                                               std::string name,
+                                               const std::string &term,
+                                               const std::vector<HelpMatch> &matches) const {
+    std::stringstream out;
+    out << make_usage(app, std::move(name));
+    if(matches.empty()) {
+        out << '\n' << get_label("No help matches") << " \"" << term << "\"\n";
+        return out.str();
+    }
+
+    // Bucket the matches by the App that lists them, their kind and group, in the order first seen
+    struct Bucket {
+        std::string title;
+        bool is_positional;
+        std::vector<const Option *> opts;
+        std::vector<const App *> subcommands;
+    };
+    std::vector<Bucket> buckets;
+    std::map<std::pair<const App *, std::string>, std::size_t> bucket_index;
+    for(const HelpMatch &match : matches) {
+        bool is_positional = match.option != nullptr && !match.option->nonpositional();
+        std::string title = is_positional ? get_label("Positionals") : match.group;
+        // the kind is part of the key so an option group named like a subcommand group stays apart
+        char kind = match.option == nullptr ? 's' : (is_positional ? 'p' : 'o');
+        auto inserted = bucket_index.emplace(std::make_pair(match.app, kind + title), buckets.size());
+        if(inserted.second) {
+            // entries of a subcommand are titled with its path below app
+            for(const App *owner = match.app; owner != nullptr && owner != app; owner = owner->get_parent()) {
+                if(!owner->get_name().empty())
+                    title = owner->get_name() + " " + title;
+            }
+            buckets.push_back(Bucket{title, is_positional, {}, {}});
+        }
+        Bucket &bucket = buckets[inserted.first->second];
+        if(match.option != nullptr)
+            bucket.opts.push_back(match.option);
+        else
+            bucket.subcommands.push_back(match.subcommand);
+    }
+
+    for(const Bucket &bucket : buckets) {
+        if(!bucket.opts.empty()) {
+            out << make_group(bucket.title, bucket.is_positional, bucket.opts);
+        } else {
+            out << "\n" << bucket.title << ":\n";
+            for(const App *sub : bucket.subcommands)
+                out << make_subcommand(sub);
+        }
+    }
+    return out.str();
+}
+
+CLI11_INLINE std::string Formatter::make_subcommands(const App *app, AppFormatMode mode) const {
+    std::ostringstream out;
+    _write_subcommands(out, app, mode);
+    return out.str();
+}
+
+CLI11_INLINE std::string Formatter::make_subcommand(const App *sub) const {
+    std::ostringstream out;
+    _write_subcommand(out, sub);
+    return out.str();
+}
+
+CLI11_INLINE std::string Formatter::make_expanded(const App *sub) const {
+    std::ostringstream out;
+    _write_expanded(out, sub);
+    return out.str();
+}
+
+
+CLI11_INLINE std::string Formatter::make_option_name(const Option *opt, bool is_positional) const {
+    if(is_positional)
+        return opt->get_name(true, false);
+
+    return opt->get_name(false, true);
+}
+
+CLI11_INLINE std::string Formatter::make_option_opts(const Option *opt) const {
+    std::stringstream out;
+
+    if(!opt->get_option_text().empty()) {
+        out << " " << opt->get_option_text();
+    } else {
+        if(opt->get_type_size() != 0) {
+            if(!opt->get_type_name().empty())
+                out << " " << get_label(opt->get_type_name());
+            if(!opt->get_default_str().empty())
+                out << "=" << opt->get_default_str();
+            if(opt->get_expected_max() == detail::expected_max_vector_size)
+                out << " ...";
+            else if(opt->get_expected_min() > 1)
+                out << " x " << opt->get_expected();
+
+            if(opt->get_required())
+                out << " " << get_label("REQUIRED");
+        }
+        if(!opt->get_envname().empty())
+            out << " (" << get_label("Env") << ":" << opt->get_envname() << ")";
+        if(!opt->get_needs().empty()) {
+            out << " " << get_label("Needs") << ":";
+            for(const Option *op : opt->get_needs())
+                out << " " << op->get_name();
+        }
+        if(!opt->get_excludes().empty()) {
+            out << " " << get_label("Excludes") << ":";
+            for(const Option *op : opt->get_excludes())
+                out << " " << op->get_name();
+        }
+    }
+    return out.str();
+}
+
+CLI11_INLINE std::string Formatter::make_option_desc(const Option *opt) const { return opt->get_description(); }
+
+CLI11_INLINE std::string Formatter::make_option_usage(const Option *opt) const {
+    // Note that these are positionals usages
+    std::stringstream out;
+    out << make_option_name(opt, true);
+    if(opt->get_expected_max() >= detail::expected_max_vector_size)
+        out << "...";
+    else if(opt->get_expected_max() > 1)
+        out << "(" << opt->get_expected() << "x)";
+
+    return opt->get_required() ? out.str() : "[" + out.str() + "]";
+}
+
+CLI11_INLINE std::string StreamFormatter::make_help(const App *app, std::string name, AppFormatMode mode) const {
+    std::ostringstream out;
+    write_help(out, app, std::move(name), mode);
+    return out.str();
+}
+
+CLI11_INLINE void
+Formatter::_write_help(std::ostream &out, const App *app, const std::string &name, AppFormatMode mode) const {
+    // This immediately forwards to the expanded form. This is done this way so that subcommands can
+    // have overridden formatters
+    if(mode == AppFormatMode::Sub) {
+        write_expanded(out, app);
+        return;
+    }
+
+    if((app->get_name().empty()) && (app->get_parent() != nullptr)) {
+        if(app->get_group() != "Subcommands") {
+            out << app->get_group() << ':';
+        }
+    }
+
+    out << make_description(app);
+    out << make_usage(app, name);
+    write_positionals(out, app);
+    write_groups(out, app, mode);
+    write_subcommands(out, app, mode);
+    out << '\n' << make_footer(app);
+}
+
+CLI11_INLINE void Formatter::_write_group(std::ostream &out,
+                                          const std::string &group,
+                                          bool is_positional,
+                                          const std::vector<const Option *> &opts) const {
+    out << "\n" << group << ":\n";
+    for(const Option *opt : opts) {
+        write_option(out, opt, is_positional);
+    }
+}
+
+CLI11_INLINE void Formatter::_write_positionals(std::ostream &out, const App *app) const {
+    std::vector<const Option *> opts;
+    for(const Option *opt : app->options_view()) {
+        if(!opt->get_group().empty() && opt->get_positional())
+            opts.push_back(opt);
+    }
+
+    if(!opts.empty())
+        write_group(out, get_label("Positionals"), true, opts);
+}
+
+CLI11_INLINE void Formatter::_write_groups(std::ostream &out, const App *app, AppFormatMode mode) const {
+    // Bucket the options by group in one pass; groups are kept in order of first appearance, like get_groups()
+    std::vector<std::string> groups;
+    std::vector<std::vector<const Option *>> buckets;
+    std::map<std::string, std::size_t> group_index;
+    for(const Option *opt : app->options_view()) {
+        auto inserted = group_index.emplace(opt->get_group(), groups.size());
+        if(inserted.second) {
+            groups.push_back(opt->get_group());
+            buckets.emplace_back();
+        }
+        if(opt->nonpositional() &&
+           (mode != AppFormatMode::Sub || (app->get_help_ptr() != opt && app->get_help_all_ptr() != opt))) {
+            buckets[inserted.first->second].push_back(opt);
+        }
+    }
+
+    for(std::size_t i = 0; i < groups.size(); ++i) {
+        if(!groups[i].empty() && !buckets[i].empty()) {
+            write_group(out, groups[i], false, buckets[i]);
+
+            if(i + 1 != groups.size())
+                out << "\n";
+        }
+    }
+}
+
+CLI11_INLINE void Formatter::_write_subcommands(std::ostream &out, const App *app, AppFormatMode mode) const {
+    // Bucket the named subcommands by group (ignoring case) in one pass, expanding option groups as they are seen
+    std::vector<std::string> groups;
+    std::vector<std::vector<const App *>> buckets;
+    std::map<std::string, std::size_t> group_index;
+    for(const App *com : app->subcommands_view()) {
+        if(com->get_name().empty()) {
+            if(!com->get_group().empty()) {
+                write_expanded(out, com);
+            }
+            continue;
+        }
+        const std::string &group_key = com->get_group();
+        if(group_key.empty()) {
+            continue;
+        }
+        auto inserted = group_index.emplace(detail::to_lower(group_key), groups.size());
+        if(inserted.second) {
+            groups.push_back(group_key);
+            buckets.emplace_back();
+        }
+        buckets[inserted.first->second].push_back(com);
+    }
+
+    for(std::size_t i = 0; i < groups.size(); ++i) {
+        out << "\n" << groups[i] << ":\n";
+        for(const App *new_com : buckets[i]) {
+            if(mode != AppFormatMode::All) {
+                write_subcommand(out, new_com);
+            } else {
+                new_com->help(out, new_com->get_name(), AppFormatMode::Sub);
+                out << "\n";
+            }
+        }
+    }
+}
+
+CLI11_INLINE void Formatter::_write_subcommand(std::ostream &out, const App *sub) const {
+    detail::format_help(out, sub->get_display_name(true), sub->get_description(), column_width_);
+}
+
+CLI11_INLINE void Formatter::_write_expanded(std::ostream &out, const App *sub) const {
+    // The expanded form has its blank lines dropped and is indented as a whole, so it is assembled locally
+    std::ostringstream local;
+    local << sub->get_display_name(true) << "\n";
+
+    local << make_description(sub);
+    if(sub->get_name().empty() && !sub->get_aliases().empty()) {
+        detail::format_aliases(local, sub->get_aliases(), column_width_ + 2);
+    }
+    write_positionals(local, sub);
+    write_groups(local, sub, AppFormatMode::Sub);
+    write_subcommands(local, sub, AppFormatMode::Sub);
+
+    // Drop blank spaces
+    std::string tmp = detail::find_and_replace(local.str(), "\n\n", "\n");
+    tmp = tmp.substr(0, tmp.size() - 1);  // Remove the final '\n'
+
+    // Indent all but the first line (the name)
+    out << detail::find_and_replace(tmp, "\n", "\n  ") << "\n";
+}
+
+CLI11_INLINE void Formatter::_write_option(std::ostream &out, const Option *opt, bool is_positional) const {
+    detail::format_help(
+        out, make_option_name(opt, is_positional) + make_option_opts(opt), make_option_desc(opt), column_width_);
+}
+
+// [CLI11:formatter_inl_hpp:end]
+}  // namespace CLI
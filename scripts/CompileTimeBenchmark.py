@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+"""
+Compare build times of the header-only and the precompiled (CLI11_PRECOMPILED) configurations.
+
+Each configuration is configured in its own build directory, then the tests and examples are built from
+scratch and once more after touching a single test source, which is the edit-compile loop a user sees.
+Extra arguments after -- are passed to every CMake configure call.
+"""
+
+from __future__ import print_function, unicode_literals
+
+import os
+import shutil
+import subprocess
+import time
+from argparse import ArgumentParser
+
+DIR = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+
+
+def timed(cmd):
+    start = time.time()
+    subprocess.check_call(cmd, stdout=subprocess.DEVNULL)
+    return time.time() - start
+
+
+def bench(name, build_dir, precompiled, jobs, touch, extra):
+    if os.path.exists(build_dir):
+        shutil.rmtree(build_dir)
+    subprocess.check_call(
+        [
+            "cmake",
+            "-S",
+            DIR,
+            "-B",
+            build_dir,
+            "-DCMAKE_BUILD_TYPE=Release",
+            "-DCLI11_PRECOMPILED={}".format("ON" if precompiled else "OFF"),
+        ]
+        + extra,
+        stdout=subprocess.DEVNULL,
+    )
+    build = ["cmake", "--build", build_dir, "-j{}".format(jobs)]
+    full = timed(build)
+    os.utime(touch, None)
+    incremental = timed(build)
+    print("{:<14} full build {:7.1f} s   rebuild after touching one test {:6.1f} s".format(name, full, incremental))
+    return full, incremental
+
+
+def main():
+    parser = ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--build-dir", default=os.path.join(DIR, "build-compile-time"), help="Scratch directory")
+    parser.add_argument("-j", "--jobs", type=int, default=os.cpu_count() or 1, help="Parallel build jobs")
+    parser.add_argument("--touch", default=os.path.join(DIR, "tests", "SimpleTest.cpp"), help="File to touch")
+    parser.add_argument("cmake_args", nargs="*", help="Extra CMake configure arguments (after --)")
+    args = parser.parse_args()
+
+    header_only = bench(
+        "header-only", os.path.join(args.build_dir, "header"), False, args.jobs, args.touch, args.cmake_args
+    )
+    precompiled = bench(
+        "precompiled", os.path.join(args.build_dir, "precompiled"), True, args.jobs, args.touch, args.cmake_args
+    )
+    print(
+        "speedup        full build {:6.2f}x   rebuild after touching one test {:5.2f}x".format(
+            header_only[0] / precompiled[0], header_only[1] / precompiled[1]
+        )
+    )
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,15 @@
+// Copyright (c) 2017-2021, University of Cincinnati, developed by Henry Schreiner
+// under NSF AWARD 1414736 and by the respective contributors.
+// All rights reserved.
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Compiled with CLI11_COMPILE defined: every CLI11_INLINE definition is emitted once here, and users of the
+// CLI11_precompiled target only see the declarations.
+
+#include "CLI/impl/App_inl.hpp"
+#include "CLI/impl/Config_inl.hpp"
+#include "CLI/impl/Formatter_inl.hpp"
+#include "CLI/impl/Option_inl.hpp"
+#include "CLI/impl/Split_inl.hpp"
+#include "CLI/impl/StringTools_inl.hpp"
@@ -0,0 +1,227 @@
+// Copyright (c) 2017-2021, University of Cincinnati, developed by Henry Schreiner
+// under NSF AWARD 1414736 and by the respective contributors.
+// All rights reserved.
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "CLI/CLI.hpp"
+#include "CLI/CountAllocations.hpp"
+
+#include "catch.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Allocation budgets for representative CLIs. Each budget is a number of allocations per option, argument or line
+// over a baseline measured in the same test on an App without options, so the fixed costs of the standard library
+// (std::function, streams, locales) do not enter the budgets. A change that needs more should raise them on purpose.
+
+namespace {
+
+/// Count the allocations made by the current thread since the object was created
+class AllocationMeter {
+  public:
+    std::size_t count() const { return CLI::allocations().count - start_.count; }
+    std::size_t bytes() const { return CLI::allocations().bytes - start_.bytes; }
+
+  private:
+    CLI::AllocationCount start_{CLI::allocations()};
+};
+
+struct Settings {
+    std::string name{};
+    int count{0};
+    double ratio{0.0};
+    std::vector<int> values{};
+    bool verbose{false};
+    std::string output{};
+};
+
+/// The number of options add_options adds, besides the subcommand
+const std::size_t option_count{6};
+
+/// A small program with a few options of common types and one subcommand
+void add_options(CLI::App &app, Settings &settings) {
+    app.add_option("-n,--name", settings.name, "A name");
+    app.add_option("-c,--count", settings.count, "A count");
+    app.add_option("-r,--ratio", settings.ratio, "A ratio");
+    app.add_option("--values", settings.values, "Some values");
+    app.add_flag("-v,--verbose", settings.verbose, "Print more");
+    CLI::App *run = app.add_subcommand("run", "Run the program");
+    run->add_option("-o,--output", settings.output, "The output file");
+}
+
+std::vector<std::string> reversed_args() {
+    std::vector<std::string> args{
+        "-n", "joe", "--count", "3", "-r", "0.5", "--values", "1", "2", "3", "-v", "run", "-o", "file"};
+    std::reverse(args.begin(), args.end());
+    return args;
+}
+
+}  // namespace
+
+TEST_CASE("Allocations: Counted", "[allocation]") {
+    CHECK(CLI::detail::allocations_counted());
+    AllocationMeter meter;
+    std::vector<int> data(16);
+    CHECK(meter.count() == 1u);
+    CHECK(meter.bytes() >= 16 * sizeof(int));
+
+    // the array and nothrow forms are counted as well
+    std::unique_ptr<int[]> array(new int[4]);
+    CHECK(meter.count() == 2u);
+    std::unique_ptr<int> nothrow(new(std::nothrow) int(3));
+    CHECK(meter.count() == 3u);
+#if defined(__cpp_aligned_new) && __cpp_aligned_new >= 201606L
+    struct alignas(64) Wide {
+        char data[64];
+    };
+    std::unique_ptr<Wide> wide(new Wide);
+    CHECK(meter.count() == 4u);
+    CHECK(reinterpret_cast<std::uintptr_t>(wide.get()) % 64 == 0u);
+#endif
+}
+
+TEST_CASE("Allocations: Construction", "[allocation]") {
+    Settings settings;
+    CLI::App baseline{"A representative program", "prog"};
+    AllocationMeter subcommand_meter;
+    baseline.add_subcommand("run", "Run the program");
+    std::size_t subcommand = subcommand_meter.count();
+
+    CLI::App app{"A representative program", "prog"};
+    AllocationMeter meter;
+    add_options(app, settings);
+    std::size_t count = meter.count();
+    INFO("options: " << count << ", subcommand: " << subcommand);
+    CHECK(count <= subcommand + 12 * option_count);
+}
+
+TEST_CASE("Allocations: Parse", "[allocation]") {
+    CLI::App baseline{"A representative program", "prog"};
+    AllocationMeter baseline_first;
+    baseline.parse(std::vector<std::string>{});
+    std::size_t base_first = baseline_first.count();
+    AllocationMeter baseline_again;
+    baseline.parse(std::vector<std::string>{});
+    std::size_t base_again = baseline_again.count();
+
+    Settings settings;
+    CLI::App app{"A representative program", "prog"};
+    add_options(app, settings);
+
+    std::vector<std::string> args = reversed_args();
+    const std::size_t arg_count = args.size();
+    AllocationMeter first;
+    app.parse(std::move(args));
+    std::size_t first_count = first.count();
+    INFO("first parse: " << first_count << ", baseline: " << base_first);
+    CHECK(first_count <= base_first + 4 * arg_count);
+    CHECK(settings.output == "file");
+
+    // a parse again with the same options reuses the storage of the results
+    args = reversed_args();
+    AllocationMeter again;
+    app.parse(std::move(args));
+    std::size_t again_count = again.count();
+    INFO("repeated parse: " << again_count << ", baseline: " << base_again);
+    CHECK(again_count <= base_again + option_count);
+}
+
+/// Allocations of the first and the repeated parse of a program with count scalar options, all of them given
+std::pair<std::size_t, std::size_t> scalar_parse_allocations(std::size_t count) {
+    CLI::App app{"Many scalar options", "prog"};
+    std::vector<int> values(count);
+    std::vector<std::string> args;
+    for(std::size_t i = 0; i < count; ++i) {
+        app.add_option("--option" + std::to_string(i), values[i]);
+        args.push_back("--option" + std::to_string(i));
+        args.push_back(std::to_string(i));
+    }
+    std::reverse(args.begin(), args.end());
+    std::vector<std::string> again_args = args;
+
+    AllocationMeter first;
+    app.parse(std::move(args));
+    std::size_t first_count = first.count();
+    AllocationMeter again;
+    app.parse(std::move(again_args));
+    std::size_t again_count = again.count();
+    CHECK(values.back() == static_cast<int>(count - 1));
+    return {first_count, again_count};
+}
+
+TEST_CASE("Allocations: Many scalar options", "[allocation]") {
+    // the first parse stores one result per option and nothing else grows with the number of options; a parse
+    // again reuses every buffer and the converted values are cached inline
+    std::pair<std::size_t, std::size_t> small = scalar_parse_allocations(100);
+    std::pair<std::size_t, std::size_t> large = scalar_parse_allocations(1000);
+    INFO("100 options: " << small.first << " then " << small.second);
+    INFO("1000 options: " << large.first << " then " << large.second);
+    CHECK(large.first - small.first <= 2 * 900);
+    CHECK(large.second <= small.second + 4);
+}
+
+TEST_CASE("Allocations: Config", "[allocation]") {
+    CLI::App baseline{"A representative program", "prog"};
+    std::istringstream empty;
+    AllocationMeter baseline_meter;
+    baseline.parse_from_stream(empty);
+    std::size_t base = baseline_meter.count();
+
+    Settings settings;
+    CLI::App app{"A representative program", "prog"};
+    add_options(app, settings);
+
+    std::istringstream input("name=joe\ncount=3\nratio=0.5\nvalues=1 2 3\n[run]\noutput=file\n");
+    const std::size_t lines{6};
+    AllocationMeter meter;
+    app.parse_from_stream(input);
+    std::size_t count = meter.count();
+    INFO("config: " << count << ", baseline: " << base);
+    CHECK(count <= base + 12 * lines);
+    CHECK(settings.values.size() == 3u);
+}
+
+TEST_CASE("Allocations: Help", "[allocation]") {
+    CLI::App baseline{"A representative program", "prog"};
+    AllocationMeter baseline_meter;
+    std::string base_help = baseline.help();
+    std::size_t base = baseline_meter.count();
+
+    Settings settings;
+    CLI::App app{"A representative program", "prog"};
+    add_options(app, settings);
+
+    AllocationMeter meter;
+    std::string help = app.help();
+    std::size_t count = meter.count();
+    INFO("help: " << count << ", baseline: " << base);
+    CHECK(count <= base + 8 * option_count);
+    CHECK(help.size() > base_help.size());
+}
+
+TEST_CASE("Allocations: Profile", "[allocation]") {
+    Settings settings;
+    CLI::App app{"A representative program", "prog"};
+    add_options(app, settings);
+    app.profile();
+
+    app.parse(reversed_args());
+    const CLI::ParseProfile &profile = *app.get_profile();
+    CHECK(profile.library_allocations().count > 0u);
+    // the options store their results in variables, so no user code runs
+    CHECK(profile.user_allocations().count == 0u);
+    CHECK_THAT(profile.to_string(), Catch::Matchers::Contains("allocs"));
+
+    // help is given for the subcommand that was used
+    app.help();
+    const CLI::PhaseRecord *help = profile.find("prog run", CLI::ParsePhase::help);
+    REQUIRE(help != nullptr);
+    CHECK(help->allocations.count > 0u);
+}
@@ -5,6 +5,8 @@
 // SPDX-License-Identifier: BSD-3-Clause
 
 #include "app_helper.hpp"
+#include <algorithm>
+#include <chrono>
 #include <complex>
 #include <cstdint>
 #include <cstdlib>
@@ -56,6 +58,31 @@ TEST_CASE_METHOD(TApp, "OneFlagShortValuesAs", "[app]") {
     CHECK("1,2" == opt->as<std::string>());
 }
 
+TEST_CASE_METHOD(TApp, "AsCachedResults", "[app]") {
+    auto opt = app.add_option("--threshold");
+    args = {"--threshold", "2.5"};
+    run();
+    CHECK(2.5 == opt->as<double>());
+    CHECK(2.5 == opt->as<double>());
+    CHECK(2.5f == opt->as<float>());
+    CHECK("2.5" == opt->as<std::string>());
+
+    opt->clear();
+    opt->add_result("7");
+    CHECK(7.0 == opt->as<double>());
+    CHECK(7 == opt->as<int>());
+
+    args = {"--threshold", "4"};
+    run();
+    CHECK(4.0 == opt->as<double>());
+
+    opt->add_result("5");
+    opt->multi_option_policy(CLI::MultiOptionPolicy::TakeLast);
+    CHECK(5.0 == opt->as<double>());
+    opt->multi_option_policy(CLI::MultiOptionPolicy::TakeFirst);
+    CHECK(4.0 == opt->as<double>());
+}
+
 TEST_CASE_METHOD(TApp, "OneFlagShortWindows", "[app]") {
     app.add_flag("-c,--count");
     args = {"/c"};
@@ -259,6 +286,31 @@ TEST_CASE_METHOD(TApp, "OneString", "[app]") {
     CHECK("mystring" == str);
 }
 
+TEST_CASE_METHOD(TApp, "MoveResultsIntoStrings", "[app]") {
+    std::string str;
+    std::vector<std::string> strvec;
+    int val{0};
+    auto sopt = app.add_option("-s,--string", str)->move_results();
+    auto vopt = app.add_option("-v,--vector", strvec)->move_results();
+    auto iopt = app.add_option("-i,--int", val)->move_results();
+    CHECK(sopt->get_move_results());
+    args = {"--string", "mystring", "-v", "a", "b", "c", "-i", "4"};
+    run();
+    CHECK("mystring" == str);
+    CHECK(strvec == std::vector<std::string>({"a", "b", "c"}));
+    CHECK(4 == val);
+    // the strings have been moved out but the counts remain
+    CHECK(sopt->count() == 1u);
+    CHECK(vopt->count() == 3u);
+    CHECK(sopt->results() == std::vector<std::string>(1));
+    CHECK(iopt->results() == std::vector<std::string>({"4"}));
+
+    sopt->move_results(false);
+    run();
+    CHECK("mystring" == str);
+    CHECK(sopt->results() == std::vector<std::string>({"mystring"}));
+}
+
 TEST_CASE_METHOD(TApp, "OneStringWindowsStyle", "[app]") {
     std::string str;
     app.add_option("-s,--string", str);
@@ -520,6 +572,47 @@ TEST_CASE_METHOD(TApp, "LotsOfFlags", "[app]") {
     CHECK(4u == app.count_all());
 }
 
+TEST_CASE_METHOD(TApp, "RepeatedFlagCounts", "[app]") {
+
+    int verbose{0};
+    bool quiet{false};
+    auto vopt = app.add_flag("-v,--verbose,!--silent", verbose);
+    auto qopt = app.add_flag("-q,--quiet", quiet);
+
+    args = {"-vvvv", "--verbose=3", "-v", "--silent", "-qqq"};
+    run();
+    CHECK(vopt->count() == 7u);
+    CHECK(qopt->count() == 3u);
+    CHECK(verbose == 7);
+    CHECK(quiet);
+    CHECK(qopt->as<bool>());
+    CHECK(vopt->results() == std::vector<std::string>({"true", "true", "true", "true", "3", "true", "false"}));
+    CHECK(qopt->results() == std::vector<std::string>(3, "true"));
+    CHECK(10u == app.count_all());
+}
+
+TEST_CASE_METHOD(TApp, "RepeatedFlagSum", "[app]") {
+
+    std::size_t seen{0};
+    int verbose{0};
+    CLI::Option *vopt{nullptr};
+    // callbacks of earlier options already see every occurrence of later flags
+    app.add_flag_callback("-c", [&seen, &vopt]() { seen = vopt->results().size(); });
+    vopt = app.add_flag("-v,--verbose", verbose);
+
+    args = {"-c", "-vvvvvvvv"};
+    run();
+    CHECK(verbose == 8);
+    CHECK(seen == 8u);
+    CHECK(vopt->results() == std::vector<std::string>(8, "true"));
+    // the callback gets the total, the reduced results still list every occurrence
+    CHECK(vopt->reduced_results().size() == 8u);
+
+    args = {"-vvv", "--verbose=-5"};
+    run();
+    CHECK(verbose == -2);
+}
+
 TEST_CASE_METHOD(TApp, "NumberFlags", "[app]") {
 
     int val{0};
@@ -714,6 +807,41 @@ TEST_CASE_METHOD(TApp, "DefaultOpts", "[app]") {
     CHECK(s == "9");
 }
 
+/// a value that counts how often it is written to a stream
+struct streamCounter {
+    int value{0};
+};
+static int streamCounterWrites{0};
+
+std::ostream &operator<<(std::ostream &out, const streamCounter &sc) {
+    ++streamCounterWrites;
+    return out << sc.value;
+}
+
+std::istream &operator>>(std::istream &in, streamCounter &sc) { return in >> sc.value; }
+
+TEST_CASE_METHOD(TApp, "DeferredDefaultCapture", "[app]") {
+
+    streamCounterWrites = 0;
+    streamCounter val;
+    val.value = 7;
+    auto opt = app.add_option("--val", val)->capture_default_str();
+    CHECK(streamCounterWrites == 0);
+
+    args = {"--val", "3"};
+    run();
+    CHECK(val.value == 3);
+    CHECK(streamCounterWrites == 0);
+    // the value at the time of capture is used, converted only when requested and never stored by the const getter
+    CHECK(opt->get_default_str() == "7");
+    CHECK(opt->get_default_str() == "7");
+    CHECK(streamCounterWrites == 2);
+
+    opt->capture_default_str()->default_str("5");
+    CHECK(opt->get_default_str() == "5");
+    CHECK(streamCounterWrites == 2);
+}
+
 TEST_CASE_METHOD(TApp, "TakeLastOpt", "[app]") {
 
     std::string str;
@@ -762,6 +890,41 @@ TEST_CASE_METHOD(TApp, "TakeFirstOpt2", "[app]") {
     CHECK("one" == str);
 }
 
+TEST_CASE_METHOD(TApp, "TakeLastFirstBoundedStorage", "[app]") {
+
+    std::string last;
+    std::string first;
+    std::pair<int, int> lastpair;
+    auto lopt = app.add_option("--last", last)->take_last();
+    auto fopt = app.add_option("--first", first)->take_first();
+    auto popt = app.add_option("--pair", lastpair)->take_last();
+
+    for(int ii = 0; ii < 1000; ++ii) {
+        args.push_back("--last=" + std::to_string(ii));
+        args.push_back("--first=" + std::to_string(ii));
+        args.push_back("--pair");
+        args.push_back(std::to_string(ii));
+        args.push_back(std::to_string(-ii));
+    }
+
+    run();
+
+    CHECK("999" == last);
+    CHECK("0" == first);
+    CHECK(lastpair == std::make_pair(999, -999));
+    CHECK(lopt->count() == 1000u);
+    CHECK(fopt->count() == 1000u);
+    CHECK(popt->count() == 2000u);
+    CHECK(lopt->results().size() < 2u);
+    CHECK(fopt->results() == std::vector<std::string>({"0"}));
+    CHECK(popt->results().size() < 4u);
+
+    // validators need to see every value so nothing is dropped
+    lopt->check(CLI::Number);
+    run();
+    CHECK(lopt->results().size() == 1000u);
+}
+
 TEST_CASE_METHOD(TApp, "JoinOpt", "[app]") {
 
     std::string str;
@@ -1634,6 +1797,74 @@ TEST_CASE_METHOD(TApp, "OriginalOrder", "[app]") {
     CHECK(std::vector<CLI::Option *>({op1, op2, op1, op1}) == app.parse_order());
 }
 
+TEST_CASE_METHOD(TApp, "OriginalOrderSpans", "[app]") {
+    std::vector<int> st1;
+    CLI::Option *op1 = app.add_option("-a", st1);
+    std::vector<int> st2;
+    CLI::Option *op2 = app.add_option("-b", st2);
+    auto sub = app.add_subcommand("sub");
+    int val{0};
+    CLI::Option *op3 = sub->add_option("--val", val);
+
+    args = {"-a", "1", "2", "3", "-b", "4", "-a", "5", "sub", "--val=6"};
+    run();
+
+    const CLI::ParseOrder &order = app.parse_order_view();
+    CHECK(order.size() == 5u);
+    REQUIRE(order.spans().size() == 3u);
+    CHECK(order.spans()[0].option == op1);
+    CHECK(order.spans()[0].count == 3u);
+    CHECK(order.spans()[0].position == 1u);
+    CHECK(order.spans()[2].position == 7u);
+
+    std::vector<std::size_t> positions;
+    for(auto it = order.begin(); it != order.end(); ++it) {
+        positions.push_back(it.position());
+    }
+    CHECK(positions == std::vector<std::size_t>({1, 2, 3, 5, 7}));
+    CHECK(order.to_vector() == std::vector<CLI::Option *>({op1, op1, op1, op2, op1}));
+
+    REQUIRE(sub->parse_order_view().spans().size() == 1u);
+    CHECK(sub->parse_order_view().spans()[0].option == op3);
+    CHECK(sub->parse_order_view().spans()[0].position == 9u);
+
+    // a new parse starts a new order
+    args = {"-b", "7"};
+    run();
+    CHECK(app.parse_order() == std::vector<CLI::Option *>({op2}));
+    CHECK(sub->parse_order().empty());
+}
+
+TEST_CASE_METHOD(TApp, "OriginalOrderRepeatedFlag", "[app]") {
+    int verbose{0};
+    CLI::Option *flag = app.add_flag("-v", verbose);
+    std::vector<int> values;
+    CLI::Option *opt = app.add_option("-a", values);
+
+    args = {"-vvvv", "-a", "1", "-vv", "-v"};
+    run();
+    CHECK(verbose == 7);
+
+    // the values of one argument share a span
+    const CLI::ParseOrder &order = app.parse_order_view();
+    REQUIRE(order.spans().size() == 4u);
+    CHECK(order.spans()[0].option == flag);
+    CHECK(order.spans()[0].count == 4u);
+    CHECK(order.spans()[0].repeated);
+    CHECK(order.spans()[1].option == opt);
+    CHECK(order.spans()[2].count == 2u);
+    CHECK(order.spans()[3].count == 1u);
+
+    std::vector<std::size_t> positions;
+    for(auto it = order.begin(); it != order.end(); ++it) {
+        positions.push_back(it.position());
+    }
+    CHECK(positions == std::vector<std::size_t>({0, 0, 0, 0, 2, 3, 3, 4}));
+
+    std::vector<CLI::Option *> flat = app.parse_order();
+    CHECK(flat == std::vector<CLI::Option *>({flag, flag, flag, flag, opt, flag, flag, flag}));
+}
+
 TEST_CASE_METHOD(TApp, "NeedsFlags", "[app]") {
     CLI::Option *opt = app.add_flag("-s,--string");
     app.add_flag("--both")->needs(opt);
@@ -1673,6 +1904,41 @@ TEST_CASE_METHOD(TApp, "ExcludesFlags", "[app]") {
     CHECK_THROWS_AS(opt->excludes(opt), CLI::IncorrectConstruction);
 }
 
+TEST_CASE_METHOD(TApp, "ExcludesDenseGroup", "[app]") {
+    // every flag excludes every other one, spread over more than one word of the requirement sets
+    std::vector<CLI::Option *> flags;
+    for(int i = 0; i < 100; ++i) {
+        CLI::Option *flag = app.add_flag("--f" + std::to_string(i));
+        for(CLI::Option *other : flags)
+            flag->excludes(other);
+        flags.push_back(flag);
+    }
+    args = {"--f70"};
+    run();
+
+    args = {"--f99", "--f3"};
+    try {
+        run();
+        FAIL("no error");
+    } catch(const CLI::ExcludesError &e) {
+        CHECK(std::string(e.what()) == "--f3 excludes --f99");
+    }
+
+    // changes after a parse are seen by the next one
+    flags[3]->remove_excludes(flags[99]);
+    flags[99]->remove_excludes(flags[3]);
+    run();
+
+    // an option in an option group excluding one of the main App is checked as well
+    auto group = app.add_option_group("group");
+    group->add_flag("--grouped")->excludes(flags[0]);
+    args = {"--f0", "--grouped"};
+    CHECK_THROWS_AS(run(), CLI::ExcludesError);
+    group->excludes(flags[1]);
+    args = {"--f1", "--grouped"};
+    CHECK_THROWS_AS(run(), CLI::ExcludesError);
+}
+
 TEST_CASE_METHOD(TApp, "ExcludesMixedFlags", "[app]") {
     CLI::Option *opt1 = app.add_flag("--opt1");
     app.add_flag("--opt2");
@@ -2279,3 +2545,216 @@ TEST_CASE_METHOD(TApp, "CustomUserSepParse5", "[app]") {
     run();
     CHECK(std::vector<std::string>({"this", "is", "a", "test"}) == bar);
 }
+
+TEST_CASE_METHOD(TApp, "ExportJson", "[app]") {
+    using Catch::Matchers::Contains;
+    auto build = [](CLI::App &target) {
+        target.description("A \"quoted\" description");
+        auto mode = target.add_option("--mode,-m", "Speed")->check(CLI::IsMember({"fast", "slow"}))->envname("MODE");
+        auto level = target.add_option("level")->expected(1, 3)->required();
+        level->needs(mode);
+        mode->excludes(target.add_flag("--quiet"));
+        auto sub = target.add_subcommand("run", "Run it")->alias("r");
+        sub->require_option(1);
+        sub->add_flag("--dry");
+        auto check = target.add_subcommand("check");
+        check->needs(mode);
+        check->excludes(sub);
+    };
+    build(app);
+    std::string json = app.export_json();
+    CHECK_THAT(json, Contains("\"description\":\"A \\\"quoted\\\" description\""));
+    CHECK_THAT(json, Contains("\"snames\":[\"m\"],\"lnames\":[\"mode\"],\"pname\":\"\",\"envname\":\"MODE\""));
+    CHECK_THAT(json, Contains("\"candidates\":[\"fast\",\"slow\"]"));
+    CHECK_THAT(json, Contains("\"pname\":\"level\""));
+    CHECK_THAT(json, Contains("\"expected\":[1,3],\"required\":true"));
+    CHECK_THAT(json, Contains("\"needs\":[\"--mode\"]"));
+    CHECK_THAT(json, Contains("\"excludes\":[\"--quiet\"]"));
+    CHECK_THAT(json, Contains("\"name\":\"run\",\"description\":\"Run it\",\"aliases\":[\"r\"]"));
+    CHECK_THAT(json, Contains("\"require_option\":[1,1]"));
+    CHECK_THAT(json, Contains("\"lnames\":[\"dry\"]"));
+    CHECK_THAT(json,
+               Contains("\"need_options\":[\"--mode\"],\"need_subcommands\":[],\"exclude_options\":[],"
+                        "\"exclude_subcommands\":[\"run\"]"));
+
+    // the same definition gives the same bytes
+    CLI::App other;
+    build(other);
+    CHECK(other.export_json() == json);
+}
+
+TEST_CASE_METHOD(TApp, "ParseLimits", "[app]") {
+    CLI::ParseLimits limits;
+    limits.max_tokens = 6;
+    limits.max_bytes = 40;
+    limits.max_values = 3;
+    limits.max_depth = 1;
+    app.parse_limits(limits);
+    std::vector<std::string> values;
+    app.add_option("--values", values)->allow_extra_args();
+    int verbose{0};
+    app.add_flag("-v", verbose);
+    auto sub = app.add_subcommand("sub");
+    sub->add_subcommand("inner");
+    CHECK(sub->get_parse_limits().max_depth == 1u);
+
+    args = {"--values", "1", "2", "3", "sub"};
+    run();
+    CHECK(values.size() == 3u);
+
+    args = {"--values", "1", "2", "3", "4"};
+    CHECK_THROWS_AS(run(), CLI::LimitError);
+    args = {"--values", "[1,2,3,4]"};
+    CHECK_THROWS_AS(run(), CLI::LimitError);
+    args = {"--values", "[1,[2]]"};
+    CHECK_THROWS_AS(run(), CLI::LimitError);
+    args = {"-vvvv"};
+    CHECK_THROWS_AS(run(), CLI::LimitError);
+    args = {"-v", "-v", "-v", "-v", "-v", "-v", "-v"};
+    CHECK_THROWS_AS(run(), CLI::LimitError);
+    args = {"--values", std::string(40, 'x')};
+    CHECK_THROWS_AS(run(), CLI::LimitError);
+    args = {"sub", "inner"};
+    CHECK_THROWS_AS(run(), CLI::LimitError);
+
+    CHECK_THROWS_WITH(app.parse("sub sub sub sub sub sub sub", false), "More than 6 arguments were given");
+    CHECK_THROWS_AS(app.parse("--values '" + std::string(40, 'x') + "'", false), CLI::LimitError);
+    app.parse("-v -v -v sub", false);
+    CHECK(verbose == 3);
+
+    using Catch::Matchers::Contains;
+    args = {"--values", "1", "2", "3", "4"};
+    CHECK_THROWS_WITH(run(), Contains("--values: more than 3 values"));
+    CHECK(CLI::LimitError::Tokens(1).get_exit_code() == static_cast<int>(CLI::ExitCodes::LimitError));
+}
+
+TEST_CASE_METHOD(TApp, "ParseLimitsConfigAndEnv", "[app]") {
+    CLI::ParseLimits limits;
+    limits.max_values = 3;
+    limits.max_depth = 1;
+    app.parse_limits(limits);
+    std::vector<int> flags;
+    app.add_flag("--flags", flags)->delimiter(',');
+    std::vector<int> env;
+    app.add_option("--env", env)->delimiter(',')->envname("CLI11_LIMIT_TEST_ENV");
+    std::vector<std::string> opt;
+    auto oopt = app.add_option("--opt", opt)->expected(0, 4)->delimiter(',');
+
+    // a flag given in a config file
+    std::istringstream config{"flags=\"1,2,3\""};
+    app.parse_from_stream(config);
+    CHECK(flags.size() == 3u);
+    app.clear();
+    config.clear();
+    config.str("flags=\"1,2,3,4\"");
+    CHECK_THROWS_AS(app.parse_from_stream(config), CLI::LimitError);
+
+    // an environment variable
+    put_env("CLI11_LIMIT_TEST_ENV", "1,2,3");
+    run();
+    CHECK(env.size() == 3u);
+    put_env("CLI11_LIMIT_TEST_ENV", "1,2,3,4");
+    CHECK_THROWS_AS(run(), CLI::LimitError);
+    put_env("CLI11_LIMIT_TEST_ENV", "[1,[2]]");
+    CHECK_THROWS_AS(run(), CLI::LimitError);
+    unset_env("CLI11_LIMIT_TEST_ENV");
+
+    // the default of an option given without a value
+    oopt->default_str("a,b,c");
+    args = {"--opt"};
+    run();
+    CHECK(opt.size() == 3u);
+    oopt->default_str("a,b,c,d");
+    CHECK_THROWS_AS(run(), CLI::LimitError);
+}
+
+TEST_CASE_METHOD(TApp, "ParseProfile", "[app]") {
+    app.name("prog");
+    int value{0};
+    app.add_option("--value", value)->envname("PROFILE_TEST_VALUE");
+    int twice{0};
+    app.add_option_function<int>("--twice", [&twice](int val) { twice = 2 * val; });
+    auto *sub = app.add_subcommand("sub");
+    sub->add_flag("--flag");
+    std::size_t callbacks{0};
+    sub->callback([&callbacks]() { ++callbacks; });
+
+    CHECK(app.get_profile() == nullptr);
+    app.profile();
+    REQUIRE(app.get_profile() != nullptr);
+    CHECK(sub->get_profile() == app.get_profile());
+
+    app.parse("--value 3 --twice 2 sub --flag", false);
+    CHECK(value == 3);
+    CHECK(twice == 4);
+    CHECK(callbacks == 1u);
+    const CLI::ParseProfile &profile = *app.get_profile();
+    CHECK(profile.find("prog", CLI::ParsePhase::tokenize) != nullptr);
+    CHECK(profile.find("prog", CLI::ParsePhase::validate) != nullptr);
+    CHECK(profile.find("prog", CLI::ParsePhase::env) != nullptr);
+    CHECK(profile.find("prog", CLI::ParsePhase::requirements) != nullptr);
+    CHECK(profile.find("prog", CLI::ParsePhase::extras) != nullptr);
+
+    const CLI::PhaseRecord *parse_arg = profile.find("prog", CLI::ParsePhase::parse_arg);
+    REQUIRE(parse_arg != nullptr);
+    CHECK(parse_arg->calls == 2u);
+    const CLI::PhaseRecord *sub_arg = profile.find("prog sub", CLI::ParsePhase::parse_arg);
+    REQUIRE(sub_arg != nullptr);
+    CHECK(sub_arg->calls == 1u);
+
+    // the subcommand is parsed within the main App, so only its own time is self time
+    const CLI::PhaseRecord *main_args = profile.find("prog", CLI::ParsePhase::parse_args);
+    const CLI::PhaseRecord *sub_args = profile.find("prog sub", CLI::ParsePhase::parse_args);
+    REQUIRE(main_args != nullptr);
+    REQUIRE(sub_args != nullptr);
+    CHECK(main_args->total >= sub_args->total);
+    CHECK(main_args->self <= main_args->total - sub_args->total);
+
+    const CLI::PhaseRecord *user = profile.find("prog sub", CLI::ParsePhase::user_callback);
+    REQUIRE(user != nullptr);
+    CHECK(user->calls == 1u);
+    // only the function given to add_option_function is user time, converting the results is library time
+    const CLI::PhaseRecord *option_user = profile.find("prog", CLI::ParsePhase::user_callback);
+    REQUIRE(option_user != nullptr);
+    CHECK(option_user->calls == 1u);
+    REQUIRE(profile.find("prog", CLI::ParsePhase::callbacks) != nullptr);
+    CHECK(profile.user_time() == user->self + option_user->self);
+    CHECK(profile.library_time().count() > 0);
+    CHECK_THAT(profile.to_string(), Catch::Matchers::Contains("prog sub"));
+
+    // records are reset by each parse
+    app.parse("--value 4", false);
+    CHECK(profile.find("prog sub", CLI::ParsePhase::user_callback) == nullptr);
+    CHECK(profile.find("prog", CLI::ParsePhase::parse_arg)->calls == 1u);
+
+    app.profile(false);
+    CHECK(app.get_profile() == nullptr);
+    CHECK(sub->get_profile() == nullptr);
+    run();
+    CHECK(app.get_profile() == nullptr);
+}
+
+TEST_CASE_METHOD(TApp, "TracePhases", "[app]") {
+    app.name("prog");
+    app.add_subcommand("sub");
+    std::vector<std::string> names;
+    bool ordered{true};
+    app.trace_phases([&names, &ordered](const std::string &name,
+                                        std::chrono::steady_clock::time_point start,
+                                        std::chrono::steady_clock::time_point stop) {
+        names.push_back(name);
+        ordered = ordered && start <= stop;
+    });
+    REQUIRE(app.get_profile() != nullptr);
+
+    args = {"sub"};
+    run();
+    CHECK(ordered);
+    CHECK(std::find(names.begin(), names.end(), "prog validate") != names.end());
+    CHECK(std::find(names.begin(), names.end(), "prog sub parse_args") != names.end());
+    // the subcommand is parsed inside the argument loop of the main App, so it ends first
+    auto sub_args = std::find(names.begin(), names.end(), "prog sub parse_args");
+    auto main_args = std::find(names.begin(), names.end(), "prog parse_args");
+    CHECK(sub_args < main_args);
+    CHECK(app.get_profile()->find("prog sub", CLI::ParsePhase::parse_args) != nullptr);
+}
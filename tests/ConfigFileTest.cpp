@@ -6,6 +6,11 @@
 
 #include "app_helper.hpp"
 
+#ifndef CLI11_SINGLE_FILE
+// TOML support is opt-in and pulls in toml11
+#include "CLI/ConfigTOML.hpp"
+#endif
+
 #include <cstdio>
 #include <sstream>
 
@@ -978,6 +983,7 @@ TEST_CASE_METHOD(TApp, "ColonValueSep", "[config]") {
     CHECK(three == 3);
 }
 
+#ifndef CLI11_SINGLE_FILE
 TEST_CASE_METHOD(TApp, "TOMLVectordirect", "[config]") {
 
     TempFile tmpini{"TestIniTmp.ini"};
@@ -1003,6 +1009,7 @@ TEST_CASE_METHOD(TApp, "TOMLVectordirect", "[config]") {
     CHECK(two == std::vector<int>({2, 3}));
     CHECK(three == std::vector<int>({1, 2, 3}));
 }
+#endif
 
 TEST_CASE_METHOD(TApp, "TOMLStringVector", "[config]") {
 
@@ -2090,6 +2097,7 @@ TEST_CASE_METHOD(TApp, "TomlOutputOptionGroup", "[config]") {
     CHECK(locg1 < locg3);
 }
 
+#ifndef CLI11_SINGLE_FILE
 TEST_CASE_METHOD(TApp, "TomlOutputVector", "[config]") {
 
     std::vector<int> v;
@@ -2102,6 +2110,7 @@ TEST_CASE_METHOD(TApp, "TomlOutputVector", "[config]") {
     std::string str = app.config_to_str();
     CHECK(str == "vector=[1, 2, 3]\n");
 }
+#endif
 
 TEST_CASE_METHOD(TApp, "ConfigOutputVectorCustom", "[config]") {
 
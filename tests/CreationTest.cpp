@@ -549,6 +549,45 @@ TEST_CASE_METHOD(TApp, "GetOptionList", "[creation]") {
     }
 }
 
+TEST_CASE_METHOD(TApp, "IntrospectionViews", "[creation]") {
+    int two{0};
+    app.add_flag("--one")->group("A");
+    app.add_option("--two", two)->group("B");
+    app.add_flag("--three")->group("A");
+    app.add_flag("--four");
+    auto sub = app.add_subcommand("sub");
+    auto group = app.add_option_group("grp");
+
+    const CLI::App &const_app = app;
+    std::vector<const CLI::Option *> opt_list = const_app.get_options();
+    auto options = const_app.options_view();
+    REQUIRE(options.size() == opt_list.size());
+    CHECK(std::vector<const CLI::Option *>(options.begin(), options.end()) == opt_list);
+    CHECK(app.options_view()[1] == opt_list[1]);
+
+    std::vector<const CLI::Option *> visited;
+    const_app.for_each_option([&visited](const CLI::Option *opt) { visited.push_back(opt); });
+    CHECK(visited == opt_list);
+
+    auto groups = app.groups_view();
+    CHECK(std::vector<std::string>(groups.begin(), groups.end()) == app.get_groups());
+    CHECK(app.get_groups() == std::vector<std::string>({"Options", "A", "B"}));
+
+    auto subcommands = const_app.subcommands_view();
+    CHECK(std::vector<const CLI::App *>(subcommands.begin(), subcommands.end()) ==
+          std::vector<const CLI::App *>({sub, group}));
+    std::size_t count{0};
+    app.for_each_subcommand([&count](CLI::App *subc) {
+        if(!subc->get_name().empty())
+            ++count;
+    });
+    CHECK(count == 1u);
+
+    CLI::App empty;
+    CHECK(empty.get_groups() == std::vector<std::string>({"Options"}));
+    CHECK(empty.subcommands_view().empty());
+}
+
 TEST_CASE("ValidatorTests: TestValidatorCreation", "[creation]") {
     std::function<std::string(std::string &)> op1 = [](std::string &val) {
         return (val.size() >= 5) ? std::string{} : val;
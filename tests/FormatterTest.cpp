@@ -209,3 +209,86 @@ TEST_CASE("Formatter: NamelessSubInGroup", "[formatter]") {
     CHECK_THAT(help, Contains("sub2"));
     CHECK(help.find("pos") == std::string::npos);
 }
+
+TEST_CASE("Formatter: StreamMatchesFormatter", "[formatter]") {
+    CLI::App app{"My prog"};
+    app.footer("The footer");
+    int x{0};
+    std::vector<std::string> files;
+    app.add_option("-x,--ex", x, "An int")->group("Numbers")->required();
+    app.add_option("files", files, "The files");
+    app.add_flag("--flag", "A flag");
+    app.add_option("--other", x, "Another")->group("numbers");
+    app.add_option("--hidden", x)->group("");
+    app.set_help_all_flag("--help-all");
+
+    auto group = app.add_option_group("extras", "Extra options");
+    group->add_flag("--extra", "An extra flag");
+    auto sub1 = app.add_subcommand("sub1", "First")->group("Commands");
+    sub1->add_option("-y", x, "Sub int");
+    sub1->add_subcommand("inner", "Inner sub")->alias("in");
+    app.add_subcommand("sub2", "Second")->group("COMMANDS");
+    app.add_subcommand("sub3", "Third");
+    auto nameless = app.add_subcommand("", "Nameless")->group("Nameless group");
+    nameless->add_option("--nl", x, "Nameless int");
+
+    for(auto mode : {CLI::AppFormatMode::Normal, CLI::AppFormatMode::All, CLI::AppFormatMode::Sub}) {
+        std::string expected = app.help("", mode);
+        std::string expected_sub = sub1->help("", mode);
+
+        app.formatter(std::make_shared<CLI::StreamFormatter>());
+        sub1->formatter(app.get_formatter());
+        CHECK(app.help("", mode) == expected);
+        CHECK(sub1->help("", mode) == expected_sub);
+        std::ostringstream out;
+        app.help(out, "", mode);
+        CHECK(out.str() == expected);
+
+        app.formatter(std::make_shared<CLI::Formatter>());
+        sub1->formatter(app.get_formatter());
+    }
+}
+
+TEST_CASE("Formatter: StreamExit", "[formatter]") {
+    CLI::App app{"My prog"};
+    app.formatter(std::make_shared<CLI::StreamFormatter>());
+    int x{0};
+    app.add_option("--opt", x, "Something");
+
+    std::ostringstream out;
+    std::ostringstream err;
+    CHECK(app.exit(CLI::CallForHelp(), out, err) == 0);
+    CHECK(out.str() == app.help());
+    CHECK_THAT(out.str(), Contains("Something"));
+}
+
+class LowerGroupFormatter : public CLI::Formatter {
+  public:
+    std::string
+    make_group(std::string group, bool is_positional, std::vector<const CLI::Option *> opts) const override {
+        return CLI::Formatter::make_group(CLI::detail::to_lower(group) + "!", is_positional, opts);
+    }
+};
+
+class MarkedOptionFormatter : public CLI::StreamFormatter {
+  public:
+    void write_option(std::ostream &out, const CLI::Option *opt, bool) const override {
+        out << "* " << opt->get_name() << "\n";
+    }
+};
+
+TEST_CASE("Formatter: StreamOverridables", "[formatter]") {
+    CLI::App app{"My prog"};
+    int x{0};
+    app.add_option("--opt", x, "Something")->group("Settings");
+
+    app.formatter(std::make_shared<LowerGroupFormatter>());
+    CHECK_THAT(app.help(), Contains("settings!:\n"));
+
+    app.formatter(std::make_shared<MarkedOptionFormatter>());
+    std::string help = app.help();
+    CHECK_THAT(help, Contains("Settings:\n* --opt\n"));
+    std::ostringstream out;
+    app.help(out);
+    CHECK(out.str() == help);
+}
@@ -1146,6 +1146,106 @@ TEST_CASE("THelp: ChangingCaselessSetDefaulted", "[help]") {
     CHECK_THAT(help, Contains("4"));
 }
 
+TEST_CASE("THelp: CachedHelp", "[help]") {
+    CLI::App app{"My prog"};
+    app.cache_help();
+    auto sub = app.add_subcommand("sub", "A subcommand");
+    CHECK(sub->get_cache_help());
+    int x{0};
+    CLI::Option *opt = app.add_option("-x", x, "An int");
+
+    int renders{0};
+    auto fmt = std::make_shared<CLI::Formatter>();
+    app.formatter_fn([&renders, fmt](const CLI::App *a, std::string name, CLI::AppFormatMode mode) {
+        ++renders;
+        return fmt->make_help(a, name, mode);
+    });
+
+    std::string help = app.help();
+    CHECK(app.help() == help);
+    CHECK(renders == 1);
+
+    // each mode and name prefix is rendered separately
+    app.help("", CLI::AppFormatMode::All);
+    CHECK(renders == 2);
+    app.help("prog");
+    CHECK(renders == 3);
+    app.help();
+    CHECK(renders == 4);
+
+    opt->description("Another int");
+    help = app.help();
+    CHECK_THAT(help, Contains("Another int"));
+    CHECK(renders == 5);
+
+    sub->description("Changed");
+    CHECK_THAT(app.help(), Contains("Changed"));
+    fmt->column_width(50);
+    app.help();
+    app.add_flag("--flag");
+    CHECK_THAT(app.help(), Contains("--flag"));
+    CHECK(renders == 8);
+
+    // a footer callback is called every time
+    int footers{0};
+    app.footer([&footers]() { return std::to_string(++footers); });
+    app.help();
+    app.help();
+    CHECK(footers == 2);
+}
+
+TEST_CASE("THelp: CachedHelpValidatorsAndFormatter", "[help]") {
+    CLI::App app{"My prog"};
+    app.cache_help();
+    int x{0};
+    CLI::Option *opt = app.add_option("-x", x, "An int")->check(CLI::Range(0, 10).name("range"));
+    app.add_option("--req", x)->required();
+    CHECK_THAT(app.help(), Contains("[0 - 10]"));
+
+    opt->get_validator("range")->description("SMALL");
+    CHECK_THAT(app.help(), Contains("SMALL"));
+    opt->get_validator("range")->active(false);
+    CHECK_THAT(app.help(), !Contains("SMALL"));
+
+    app.get_formatter()->label("REQUIRED", "MUST");
+    CHECK_THAT(app.help(), Contains("MUST"));
+}
+
+TEST_CASE("THelp: CachedHelpAfterSubcommandParse", "[help]") {
+    CLI::App app{"My prog"};
+    auto sub = app.add_subcommand("sub", "A subcommand");
+    // turning caching on afterwards still covers the subcommand that renders the help after a parse
+    app.cache_help();
+    CHECK(sub->get_cache_help());
+
+    int renders{0};
+    auto fmt = std::make_shared<CLI::Formatter>();
+    sub->formatter_fn([&renders, fmt](const CLI::App *a, std::string name, CLI::AppFormatMode mode) {
+        ++renders;
+        return fmt->make_help(a, name, mode);
+    });
+    app.parse(std::vector<std::string>{"sub"});
+    std::string help = app.help();
+    CHECK(app.help() == help);
+    CHECK(renders == 1);
+}
+
+TEST_CASE("THelp: CachedHelpChangingSet", "[help]") {
+    CLI::App app;
+    app.cache_help();
+
+    std::set<int> vals{1, 2, 3};
+    int val{0};
+    app.add_option("--val", val)->check(CLI::IsMember(&vals));
+    CHECK_THAT(app.help(), Contains("{1,2,3}"));
+
+    // a set held by pointer is not tracked
+    vals.insert(4);
+    CHECK_THAT(app.help(), Contains("{1,2,3}"));
+    app.cache_help(false);
+    CHECK_THAT(app.help(), Contains("{1,2,3,4}"));
+}
+
 // New defaults tests (1.8)
 
 TEST_CASE("THelp: ChangingDefaults", "[help]") {
@@ -1261,3 +1361,72 @@ TEST_CASE("TVersion: parse_throw", "[help]") {
         CHECK(1U == cptr->count());
     }
 }
+
+TEST_CASE("THelp: Search", "[help]") {
+    CLI::App app{"My prog", "program"};
+    int x{0};
+    std::string file;
+    app.add_option("--verbosity", x, "How much to print");
+    app.add_option("--file", file, "Input file")->group("Input");
+    app.add_flag("--hidden", "Secret verbosity")->group("");
+    auto ogroup = app.add_option_group("Output", "Output options");
+    ogroup->add_option("--out-file", file, "Where to write the output");
+    auto sub = app.add_subcommand("render", "Render the file quietly");
+    sub->add_flag("--preview", "Show a preview");
+    sub->add_option("width", x, "Output width");
+
+    std::string found = app.help_search("verb");
+    CHECK_THAT(found, Contains("Usage: program"));
+    CHECK_THAT(found, Contains("--verbosity INT"));
+    CHECK_THAT(found, Contains("How much to print"));
+    CHECK_THAT(found, !Contains("--hidden"));
+    CHECK_THAT(found, !Contains("--file"));
+
+    // every word must match: file is in --file, --out-file and render, but only --out-file also has output
+    found = app.help_search("FILE output");
+    CHECK_THAT(found, Contains("Output:"));
+    CHECK_THAT(found, Contains("--out-file"));
+    CHECK_THAT(found, !Contains("Input"));
+    CHECK_THAT(found, !Contains("render"));
+
+    // subcommands match by description and their entries are titled with their path
+    found = app.help_search("quiet");
+    CHECK_THAT(found, Contains("Subcommands:"));
+    CHECK_THAT(found, Contains("Render the file quietly"));
+    found = app.help_search("preview");
+    CHECK_THAT(found, Contains("render Options:"));
+    CHECK_THAT(found, Contains("--preview"));
+    found = app.help_search("width");
+    CHECK_THAT(found, Contains("render Positionals:"));
+
+    CHECK_THAT(app.help_search("nothing"), Contains("No help matches \"nothing\""));
+
+    // the index follows changes to the App
+    app.add_flag("--nothing", "Does nothing");
+    CHECK_THAT(app.help_search("nothing"), Contains("Does nothing"));
+}
+
+TEST_CASE("THelp: SearchFlag", "[help]") {
+    CLI::App app{"My prog", "program"};
+    app.add_flag("--color", "Use colors");
+    app.add_flag("--quiet", "Print less");
+
+    std::vector<std::string> input{"--help=col"};
+    try {
+        app.parse(input);
+        FAIL("help was not requested");
+    } catch(const CLI::CallForHelpSearch &e) {
+        CHECK(std::string(e.what()) == "col");
+        std::stringstream out;
+        CHECK(app.exit(e, out) == 0);
+        CHECK_THAT(out.str(), Contains("--color"));
+        CHECK_THAT(out.str(), !Contains("--quiet"));
+    }
+
+    app.clear();
+    input = {"--help=true"};
+    CHECK_THROWS_AS(app.parse(input), CLI::CallForHelp);
+    app.clear();
+    input = {"--help"};
+    CHECK_THROWS_AS(app.parse(input), CLI::CallForHelp);
+}
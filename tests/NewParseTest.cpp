@@ -8,6 +8,8 @@
 
 #include <complex>
 #include <cstdint>
+#include <locale>
+#include <string>
 
 using Catch::Matchers::Contains;
 
@@ -200,6 +202,115 @@ TEST_CASE_METHOD(TApp, "custom_string_converterFail", "[newparse]") {
     CHECK_THROWS_AS(run(), CLI::ConversionError);
 }
 
+namespace fsv {
+/// point with a from_string_view parser and no stream operator
+struct point {
+    int x{0};
+    int y{0};
+};
+
+bool from_string_view(const char *str, std::size_t length, point &output) {
+    std::string input(str, length);
+    auto sep = input.find(',');
+    if(sep == std::string::npos) {
+        return false;
+    }
+    return CLI::detail::lexical_cast(input.substr(0, sep), output.x) &&
+           CLI::detail::lexical_cast(input.substr(sep + 1), output.y);
+}
+
+/// values read through streams, one of which changes the stream format
+struct hexval {
+    int v{0};
+};
+struct decval {
+    int v{0};
+};
+std::istream &operator>>(std::istream &in, hexval &val) { return in >> std::hex >> val.v; }
+std::istream &operator>>(std::istream &in, decval &val) { return in >> val.v; }
+
+/// a value whose extraction leaves every kind of stream state changed
+struct messyval {
+    int v{0};
+};
+std::istream &operator>>(std::istream &in, messyval &val) {
+    in.imbue(std::locale(std::locale(), new std::numpunct<char>));
+    in.exceptions(std::ios_base::badbit);
+    in.precision(2);
+    in.fill('*');
+    return in >> val.v;
+}
+
+/// a value that records the state of the stream it is read from
+struct stateval {
+    std::string word{};
+    bool fresh{false};
+};
+std::istream &operator>>(std::istream &in, stateval &val) {
+    val.fresh = in.exceptions() == std::ios_base::goodbit && in.precision() == 6 && in.fill() == ' ' &&
+                in.getloc() == std::locale();
+    return in >> val.word;
+}
+}  // namespace fsv
+
+static_assert(CLI::detail::has_from_string_view<fsv::point>::value, "from_string_view not detected");
+static_assert(!CLI::detail::has_from_string_view<fsv::hexval>::value, "from_string_view wrongly detected");
+
+TEST_CASE_METHOD(TApp, "fromStringViewVector", "[newparse]") {
+    std::vector<fsv::point> points;
+    app.add_option("-p,--points", points);
+
+    args = {"-p", "1,2", "3,4", "-5,6"};
+    run();
+    REQUIRE(points.size() == 3u);
+    CHECK(points[0].x == 1);
+    CHECK(points[1].y == 4);
+    CHECK(points[2].x == -5);
+
+    args = {"-p", "1:2"};
+    CHECK_THROWS_AS(run(), CLI::ConversionError);
+}
+
+TEST_CASE_METHOD(TApp, "reusedStreamFormatReset", "[newparse]") {
+    std::vector<fsv::hexval> hvals;
+    fsv::decval dval;
+    app.add_option("--hex", hvals);
+    app.add_option("--dec", dval);
+
+    args = {"--hex", "ff", "10", "--dec", "10"};
+    run();
+    REQUIRE(hvals.size() == 2u);
+    CHECK(hvals[0].v == 255);
+    CHECK(hvals[1].v == 16);
+    CHECK(dval.v == 10);
+
+    args = {"--dec", "10x"};
+    CHECK_THROWS_AS(run(), CLI::ConversionError);
+    args = {"--dec", "12"};
+    run();
+    CHECK(dval.v == 12);
+}
+
+TEST_CASE_METHOD(TApp, "reusedStreamStateReset", "[newparse]") {
+    fsv::messyval mval;
+    fsv::stateval sval;
+    app.add_option("--messy", mval);
+    app.add_option("--state", sval);
+
+    args = {"--messy", "7", "--state", "word"};
+    run();
+    CHECK(mval.v == 7);
+    CHECK(sval.word == "word");
+    CHECK(sval.fresh);
+
+    // a failed extraction after the exceptions were changed is still reported as a conversion error
+    args = {"--messy", "x"};
+    CHECK_THROWS_AS(run(), CLI::ConversionError);
+    args = {"--state", "again"};
+    run();
+    CHECK(sval.fresh);
+}
+
 /// simple class to wrap another  with a very specific type constructor and assignment operators to test out some of the
 /// option assignments
 template <class X> class objWrapper {
@@ -0,0 +1,145 @@
+// Copyright (c) 2017-2021, University of Cincinnati, developed by Henry Schreiner
+// under NSF AWARD 1414736 and by the respective contributors.
+// All rights reserved.
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "app_helper.hpp"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Settings {
+    int count{0};
+    double ratio{1.0};
+    std::string name{};
+    std::vector<int> values{};
+    bool verbose{false};
+    int level{0};
+};
+
+constexpr auto settings_schema = CLI::make_schema(CLI::field("-c,--count", &Settings::count, "The count"),
+                                                  CLI::field("--ratio", &Settings::ratio),
+                                                  CLI::field("name", &Settings::name, "A positional name"),
+                                                  CLI::field("--values", &Settings::values).expected(1, 3),
+                                                  CLI::flag("-v,--verbose", &Settings::verbose, "Be loud"),
+                                                  CLI::flag("-l", &Settings::level));
+
+}  // namespace
+
+static_assert(CLI::detail::schema_names_valid("-a,--all, pos", false), "valid names");
+static_assert(!CLI::detail::schema_names_valid("-ab", false), "short names have one character");
+static_assert(!CLI::detail::schema_names_valid("--a=b", false), "= is not allowed in long names");
+static_assert(!CLI::detail::schema_names_valid("--", false), "dashes only");
+static_assert(!CLI::detail::schema_names_valid("one,two", false), "only one positional name");
+static_assert(!CLI::detail::schema_names_valid("-a,pos", true), "flags cannot be positional");
+static_assert(CLI::detail::schema_names_valid("-x{false},!--no-x", true), "flag defaults and negations");
+static_assert(CLI::detail::schema_names_valid(" --level{2} , -l", true), "flag default with whitespace");
+static_assert(!CLI::detail::schema_names_valid("--level{2}", false), "options have no flag defaults");
+static_assert(!CLI::detail::schema_names_valid("--level{2", true), "unclosed flag default");
+static_assert(!CLI::detail::schema_names_valid("-x{1}y", true), "the default does not end the short name");
+static_assert(!CLI::detail::schema_names_valid("!x", true), "negated flags cannot be positional");
+static_assert(CLI::detail::schema_names_disjoint("-a,--all", false, "-b,--ball, pos", false), "disjoint names");
+static_assert(!CLI::detail::schema_names_disjoint("-a,--all", false, " --all ", false), "--all is repeated");
+static_assert(CLI::detail::schema_names_disjoint("--a", false, "-a", false), "short and long names differ");
+static_assert(!CLI::detail::schema_names_disjoint("--no-x", false, "-x,!--no-x{true}", true), "--no-x is repeated");
+static_assert(decltype(settings_schema)::size() == 6, "one option per field");
+
+TEST_CASE_METHOD(TApp, "SchemaBind", "[schema]") {
+    Settings settings;
+    auto opts = settings_schema.bind(app, settings);
+    CHECK(opts[0] == app.get_option("--count"));
+    CHECK(opts[2] == app.get_option("name"));
+
+    args = {"-c", "3", "--ratio", "0.5", "bob", "--values", "1", "2", "-vll", "-l"};
+    run();
+    CHECK(settings.count == 3);
+    CHECK(settings.ratio == Approx(0.5));
+    CHECK(settings.name == "bob");
+    CHECK(settings.values == std::vector<int>({1, 2}));
+    CHECK(settings.verbose);
+    CHECK(settings.level == 3);
+    CHECK(app.count("--values") == 2u);
+}
+
+TEST_CASE_METHOD(TApp, "SchemaHelp", "[schema]") {
+    Settings settings;
+    settings_schema.bind(app, settings);
+    using Catch::Matchers::Contains;
+    std::string help = app.help();
+    CHECK_THAT(help, Contains("-c,--count INT"));
+    CHECK_THAT(help, Contains("The count"));
+    CHECK_THAT(help, Contains("-v,--verbose"));
+    CHECK_THAT(help, Contains("Be loud"));
+}
+
+TEST_CASE_METHOD(TApp, "SchemaExpectedAndRequired", "[schema]") {
+    Settings settings;
+    auto schema = CLI::make_schema(CLI::field("--count", &Settings::count).required(),
+                                   CLI::field("--values", &Settings::values).expected(2));
+    schema.bind(app, settings);
+
+    args = {"--values", "1", "2"};
+    CHECK_THROWS_AS(run(), CLI::RequiredError);
+
+    args = {"--count", "1", "--values", "1", "2", "3"};
+    CHECK_THROWS_AS(run(), CLI::ArgumentMismatch);
+
+    args = {"--count", "1", "--values", "4", "5"};
+    run();
+    CHECK(settings.values == std::vector<int>({4, 5}));
+}
+
+TEST_CASE_METHOD(TApp, "SchemaRuntimeErrors", "[schema]") {
+    const char *bad_short = "-ab";
+    CHECK_THROWS_AS(CLI::field(bad_short, &Settings::count), CLI::BadNameString);
+    const char *positional = "pos";
+    CHECK_THROWS_AS(CLI::flag(positional, &Settings::verbose), CLI::BadNameString);
+
+    const char *count_name = "-c";
+    CHECK_THROWS_AS(
+        CLI::make_schema(CLI::field(count_name, &Settings::count), CLI::field(count_name, &Settings::level)),
+        CLI::OptionAlreadyAdded);
+}
+
+TEST_CASE_METHOD(TApp, "SchemaExistingOptions", "[schema]") {
+    Settings settings;
+    int other{0};
+    app.add_option("--ratio", other);
+    CHECK_THROWS_AS(settings_schema.bind(app, settings), CLI::OptionAlreadyAdded);
+}
+
+TEST_CASE_METHOD(TApp, "SchemaIgnoreCase", "[schema]") {
+    Settings settings;
+    app.option_defaults()->ignore_case();
+    auto schema = CLI::make_schema(CLI::field("--count", &Settings::count), CLI::field("--COUNT", &Settings::level));
+    CHECK_THROWS_AS(schema.bind(app, settings), CLI::OptionAlreadyAdded);
+}
+
+TEST_CASE_METHOD(TApp, "SchemaFlagDefaults", "[schema]") {
+    Settings settings;
+    constexpr auto schema = CLI::make_schema(CLI::flag("--verbose,!--quiet", &Settings::verbose),
+                                             CLI::flag("-l,--level{5},--down{-1}", &Settings::level));
+    schema.bind(app, settings);
+
+    args = {"--verbose", "--quiet"};
+    run();
+    CHECK_FALSE(settings.verbose);
+    CHECK(app.get_option("--quiet") == app.get_option("--verbose"));
+
+    args = {"-l", "--level"};
+    run();
+    CHECK(settings.level == 6);
+
+    args = {"--verbose", "--down"};
+    run();
+    CHECK(settings.verbose);
+    CHECK(settings.level == -1);
+
+    const char *repeated = "--quiet";
+    CHECK_THROWS_AS(CLI::make_schema(CLI::flag("-v,!--quiet", &Settings::verbose),
+                                     CLI::flag(repeated, &Settings::level)),
+                    CLI::OptionAlreadyAdded);
+}
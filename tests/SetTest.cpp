@@ -709,3 +709,14 @@ TEST_CASE_METHOD(TApp, "AddRemoveSetItemsNoCase", "[set]") {
     args = {"--type2", "TYpE2"};
     CHECK_THROWS_AS(run(), CLI::ValidationError);
 }
+
+TEST_CASE("SetCombinedCandidates", "[set]") {
+    CLI::IsMember first({"a", "b", "c"});
+    CLI::IsMember second({"b", "c", "d"});
+    CHECK((first & second).get_candidates() == std::vector<std::string>({"b", "c"}));
+    CHECK((first | second).get_candidates() == std::vector<std::string>({"a", "b", "c", "d"}));
+    CHECK((first & CLI::Validator("ANY")).get_candidates() == std::vector<std::string>({"a", "b", "c"}));
+    CHECK((CLI::Validator("ANY") | second).get_candidates() == std::vector<std::string>({"b", "c", "d"}));
+    // the values a negated validator accepts cannot be listed
+    CHECK((!first).get_candidates().empty());
+}
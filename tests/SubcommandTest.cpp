@@ -6,6 +6,12 @@
 
 #include "app_helper.hpp"
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
 using Catch::Matchers::Contains;
 
 using vs_t = std::vector<std::string>;
@@ -645,6 +651,131 @@ TEST_CASE_METHOD(TApp, "CallbackOrderingImmediateMain", "[subcom]") {
     CHECK(sub_val == 0);
 }
 
+TEST_CASE_METHOD(TApp, "RecordInvocations", "[subcom]") {
+    auto add = app.add_subcommand("add")->immediate_callback()->record_invocations();
+    CHECK(add->get_record_invocations());
+    std::string item;
+    int count{0};
+    add->add_option("item", item)->required();
+    add->add_option("-n,--count", count);
+    auto extra = add->add_option_group("extra");
+    extra->add_flag("--urgent");
+    auto nested = add->add_subcommand("now")->fallthrough();
+    nested->add_flag("--twice");
+
+    std::vector<std::string> seen;
+    add->callback([&item, &seen]() { seen.push_back(item); });
+
+    args = {"add", "apple", "-n", "3", "add", "pear", "--urgent", "add", "plum", "now", "--twice"};
+    run();
+    CHECK(seen == std::vector<std::string>({"apple", "pear", "plum"}));
+
+    const auto &records = add->get_invocations();
+    REQUIRE(records.size() == 3u);
+    CHECK(records[0].position() == 1u);
+    CHECK(records[0].as<std::string>("item") == "apple");
+    CHECK(records[0].as<int>("--count") == 3);
+    CHECK(records[0].count("--urgent") == 0u);
+    CHECK(records[1].position() == 5u);
+    CHECK(records[1].results("item") == std::vector<std::string>({"pear"}));
+    CHECK(records[1].count("-n") == 0u);
+    CHECK(records[1].count("--urgent") == 1u);
+    CHECK(records[2].options().size() == 1u);
+    // the last invocation stays in the options as well
+    CHECK(add->get_option("item")->as<std::string>() == "plum");
+    CHECK(nested->count("--twice") == 1u);
+
+    // a nested subcommand used by one invocation is cleared for the next
+    args = {"add", "fig", "now", "--twice", "add", "kiwi"};
+    run();
+    CHECK(add->get_invocations().size() == 2u);
+    CHECK(nested->count() == 0u);
+    CHECK(nested->count("--twice") == 0u);
+}
+
+TEST_CASE_METHOD(TApp, "IndependentCallbacks", "[subcom]") {
+    app.require_subcommand(0, 5);
+    app.callback_threads(3);
+    CHECK(app.get_callback_threads() == 3u);
+
+    std::mutex mutex;
+    std::condition_variable started;
+    int running{0};
+    bool overlapped{false};
+    std::vector<std::string> order;
+    auto stage = [&](const std::string &name) {
+        std::unique_lock<std::mutex> lock(mutex);
+        order.push_back(name);
+        ++running;
+        started.notify_all();
+        // every independent stage waits for the other two, which only finish if they run concurrently
+        overlapped = started.wait_for(lock, std::chrono::seconds(10), [&]() { return running >= 3; });
+    };
+    for(std::string name : {"a", "b", "c"}) {
+        app.add_subcommand(name)->independent()->callback([&stage, name]() { stage(name); });
+    }
+    auto last = app.add_subcommand("last");
+    CHECK_FALSE(last->get_independent());
+    int seen{0};
+    last->callback([&]() {
+        std::lock_guard<std::mutex> lock(mutex);
+        seen = static_cast<int>(order.size());
+    });
+
+    args = {"b", "a", "c", "last"};
+    run();
+    CHECK(overlapped);
+    CHECK(order.size() == 3u);
+    CHECK(seen == 3);
+}
+
+TEST_CASE_METHOD(TApp, "IndependentCallbacksReadOptions", "[subcom]") {
+    app.require_subcommand(0, 4);
+    app.callback_threads(4);
+    int level{0};
+    auto opt = app.add_option("--level", level);
+    std::atomic<int> matches{0};
+    for(std::string name : {"a", "b", "c", "d"}) {
+        app.add_subcommand(name)->independent()->callback([&matches, opt]() {
+            // concurrent const reads of the same option must not write to it
+            for(int ii = 0; ii < 100; ++ii) {
+                if(opt->as<int>() == 4 && opt->as<double>() == 4.0 && opt->as<std::string>() == "4") {
+                    ++matches;
+                }
+            }
+        });
+    }
+
+    args = {"--level", "4", "a", "b", "c", "d"};
+    run();
+    CHECK(level == 4);
+    CHECK(matches == 400);
+}
+
+TEST_CASE_METHOD(TApp, "IndependentCallbackErrors", "[subcom]") {
+    app.require_subcommand(0, 3);
+    app.callback_threads(2);
+    std::atomic<int> calls{0};
+    app.add_subcommand("one")->independent()->callback([&]() {
+        ++calls;
+        throw CLI::ValidationError("one");
+    });
+    app.add_subcommand("two")->independent()->callback([&]() {
+        ++calls;
+        throw CLI::RuntimeError(2);
+    });
+    app.add_subcommand("three")->independent()->callback([&]() { ++calls; });
+
+    args = {"two", "three", "one"};
+    CHECK_THROWS_AS(run(), CLI::RuntimeError);
+    CHECK(calls == 3);
+
+    calls = 0;
+    args = {"one", "two"};
+    CHECK_THROWS_AS(run(), CLI::ValidationError);
+    CHECK(calls == 2);
+}
+
 // Test based on issue #308
 TEST_CASE_METHOD(TApp, "CallbackOrderingImmediateModeOrder", "[subcom]") {
 
@@ -783,6 +914,39 @@ TEST_CASE_METHOD(TApp, "PrefixSubcom", "[subcom]") {
     CHECK(std::vector<std::string>({"other", "--simple", "--mine"}) == subc->remaining());
 }
 
+TEST_CASE_METHOD(TApp, "PrefixPassthroughView", "[subcom]") {
+    auto run_cmd = app.add_subcommand("run");
+    run_cmd->prefix_command();
+    app.add_flag("-v");
+
+    std::array<const char *, 6> argv{{"tool", "run", "prog", "-v", "a", nullptr}};
+    app.parse(5, argv.data());
+    CLI::ArgvView pass = run_cmd->passthrough();
+    CHECK(pass.size() == 3u);
+    // a view of argv itself, terminated like argv
+    CHECK(pass.data() == argv.data() + 2);
+    CHECK(pass.data()[3] == nullptr);
+    CHECK(std::string(pass[0]) == "prog");
+    CHECK(run_cmd->remaining() == std::vector<std::string>({"prog", "-v", "a"}));
+    CHECK(run_cmd->remaining_size() == 3u);
+    CHECK(app.passthrough().empty());
+
+    // -1 is split from -v1, so it is not an entry of argv
+    std::array<const char *, 5> split{{"tool", "-v1", "b", "c", nullptr}};
+    app.prefix_command();
+    app.parse(4, split.data());
+    pass = app.passthrough();
+    CHECK(std::vector<std::string>(pass.begin(), pass.end()) == std::vector<std::string>({"-1", "b", "c"}));
+    CHECK(pass.data()[3] == nullptr);
+
+    args = {"run", "x", "y"};
+    run();
+    pass = run_cmd->passthrough();
+    CHECK(std::vector<std::string>(pass.begin(), pass.end()) == std::vector<std::string>({"x", "y"}));
+    CHECK(pass.data()[2] == nullptr);
+    CHECK(app.passthrough().empty());
+}
+
 TEST_CASE_METHOD(TApp, "InheritHelpAllFlag", "[subcom]") {
     app.set_help_all_flag("--help-all");
     auto subc = app.add_subcommand("subc");
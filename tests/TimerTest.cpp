@@ -7,10 +7,13 @@
 #include "CLI/Timer.hpp"
 
 #include "catch.hpp"
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <sstream>
 #include <string>
 #include <thread>
+#include <vector>
 
 using Catch::Matchers::Contains;
 
@@ -68,3 +71,202 @@ TEST_CASE("Timer: TimeItTimer", "[timer]") {
     std::cout << output << std::endl;
     CHECK_THAT(output, Contains("ms"));
 }
+
+TEST_CASE("Timer: Benchmark", "[timer]") {
+    CLI::Timer timer{"Sleep"};
+    CLI::BenchmarkOptions options;
+    options.warmup_time = 0;
+    options.target_time = .05;
+    options.min_samples = 5;
+    std::size_t calls{0};
+    CLI::BenchmarkResult result = timer.benchmark(
+        [&calls]() {
+            ++calls;
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        },
+        options);
+    CHECK(result.title == "Sleep");
+    CHECK(result.calls_per_sample == 1u);
+    CHECK(result.samples + result.outliers >= 5u);
+    CHECK(calls == result.samples + result.outliers + 1);
+    CHECK(result.min >= .002);
+    CHECK(result.min <= result.median);
+    CHECK(result.median <= result.p90);
+    CHECK(result.p90 <= result.p99);
+    CHECK(result.p99 <= result.max);
+    CHECK(result.stddev >= 0);
+
+    std::string output = timer.to_string(result);
+    CHECK_THAT(output, Contains("Sleep: "));
+    CHECK_THAT(output, Contains("ms median"));
+}
+
+TEST_CASE("Timer: BenchmarkFast", "[timer]") {
+    CLI::Timer timer;
+    CLI::BenchmarkOptions options;
+    options.warmup_time = .01;
+    options.target_time = .02;
+    options.max_samples = 100;
+    volatile std::size_t sink{0};
+    CLI::BenchmarkResult result = timer.benchmark([&sink]() { sink = sink + 1; }, options);
+    // a call is far shorter than target_time / max_samples, so many calls make up a sample
+    CHECK(result.calls_per_sample > 1u);
+    CHECK(result.samples + result.outliers <= 100u);
+    CHECK(result.median > 0);
+}
+
+TEST_CASE("Timer: BenchmarkOutput", "[timer]") {
+    CLI::BenchmarkResult result;
+    result.title = "parse \"args\", fast";
+    result.samples = 3;
+    result.median = 1.5e-6;
+    CHECK(result.to_json() ==
+          "{\"title\":\"parse \\\"args\\\", fast\",\"samples\":3,\"outliers\":0,\"calls_per_sample\":1,\"min_ns\":0,"
+          "\"median_ns\":1500,\"mean_ns\":0,\"p90_ns\":0,\"p99_ns\":0,\"max_ns\":0,\"stddev_ns\":0}");
+    CHECK(CLI::BenchmarkResult::csv_header() ==
+          "title,samples,outliers,calls_per_sample,min_ns,median_ns,mean_ns,p90_ns,p99_ns,max_ns,stddev_ns,cycles,"
+          "instructions,cache_misses,branch_misses");
+    CHECK(result.to_csv() == "\"parse \"\"args\"\", fast\",3,0,1,0,1500,0,0,0,0,0,,,,");
+
+    result.counters.available[static_cast<std::size_t>(CLI::TimerCounter::instructions)] = true;
+    result.counters.values[static_cast<std::size_t>(CLI::TimerCounter::instructions)] = 250;
+    CHECK_THAT(result.to_json(), Contains(",\"stddev_ns\":0,\"instructions\":250}"));
+    CHECK(result.to_csv() == "\"parse \"\"args\"\", fast\",3,0,1,0,1500,0,0,0,0,0,,250,,");
+    CHECK_THAT(CLI::Timer{}.to_string(result), Contains("per call 250 instructions"));
+
+    result.title = "tab\there\nand \\ back";
+    CHECK_THAT(result.to_json(), Contains("{\"title\":\"tab\\there\\nand \\\\ back\","));
+}
+
+TEST_CASE("Timer: Percentile", "[timer]") {
+    std::vector<double> samples{1, 2, 3, 4, 5};
+    CHECK(CLI::Timer::percentile(samples, 0.5) == Approx(3));
+    CHECK(CLI::Timer::percentile(samples, 0.9) == Approx(4.6));
+    CHECK(CLI::Timer::percentile(samples, 1) == Approx(5));
+    CHECK(CLI::Timer::percentile(std::vector<double>{7}, 0.99) == Approx(7));
+}
+
+TEST_CASE("Timer: CounterValues", "[timer]") {
+    CLI::CounterValues start;
+    CLI::CounterValues stop;
+    for(std::size_t i = 0; i < 4; ++i) {
+        start.available[i] = true;
+        stop.available[i] = i != 2;
+        stop.values[i] = 3000000.0 * static_cast<double>(i + 1);
+    }
+    CLI::CounterValues counts = stop.since(start, 2);
+    CHECK(counts.any());
+    CHECK(counts.has(CLI::TimerCounter::cycles));
+    CHECK(!counts.has(CLI::TimerCounter::cache_misses));
+    CHECK(counts.get(CLI::TimerCounter::instructions) == Approx(3000000));
+    CHECK(counts.to_string() == "1.5M cycles, 3M instructions, 6M branch misses");
+    CHECK(CLI::CounterValues::make_count_str(999) == "999");
+    CHECK(CLI::CounterValues::make_count_str(12345) == "12.35k");
+    CHECK(!CLI::CounterValues{}.any());
+}
+
+TEST_CASE("Timer: Counters", "[timer]") {
+    CLI::Timer timer{"Counted"};
+    timer.counters();
+    volatile std::size_t sink{0};
+    for(std::size_t i = 0; i < 100000; ++i) {
+        sink = sink + i;
+    }
+    std::string output = timer.to_string();
+    CHECK_THAT(output, Contains("Counted: "));
+    CLI::CounterValues counts = timer.counter_values();
+    // perf events are often not available, for instance in containers, then only the time is measured
+    if(timer.counters_available() && counts.has(CLI::TimerCounter::instructions)) {
+        CHECK(counts.get(CLI::TimerCounter::instructions) > 100000);
+        CHECK_THAT(output, Contains("instructions"));
+    } else {
+        CHECK(!counts.any());
+        CHECK_THAT(output, !Contains("instructions"));
+    }
+
+    CLI::BenchmarkOptions options;
+    options.warmup_time = 0;
+    options.target_time = .01;
+    CLI::BenchmarkResult result = timer.benchmark([&sink]() { sink = sink + 1; }, options);
+    CHECK(result.counters.any() == timer.counters_available());
+
+    timer.counters(false);
+    CHECK(!timer.counters_available());
+    CHECK(!timer.counter_values().any());
+}
+
+TEST_CASE("Timer: TraceSpans", "[timer]") {
+    CLI::Tracer tracer;
+    {
+        CLI::TraceSpan outer{"outer", tracer};
+        { CLI::TraceSpan inner{"inner \"quoted\"", tracer}; }
+    }
+    std::vector<CLI::TraceEvent> events;
+    tracer.for_each([&events](std::uint64_t, const CLI::TraceEvent &event) { events.push_back(event); });
+    REQUIRE(events.size() == 2u);
+    // spans are recorded as they end, and the inner one lies within the outer one
+    CHECK(events[0].name == "inner \"quoted\"");
+    CHECK(events[1].name == "outer");
+    CHECK(events[0].start >= events[1].start);
+    CHECK(events[0].start + events[0].duration <= events[1].start + events[1].duration);
+
+    std::string trace = tracer.to_chrome_trace();
+    CHECK_THAT(trace, Contains("{\"traceEvents\":["));
+    CHECK_THAT(trace, Contains("\"name\":\"inner \\\"quoted\\\"\",\"cat\":\"cli11\",\"ph\":\"X\",\"ts\":"));
+    CHECK_THAT(trace, Contains("\"displayTimeUnit\":\"ns\"}"));
+
+    tracer.enable(false);
+    { CLI::TraceSpan ignored{"ignored", tracer}; }
+    CHECK(!tracer.enabled());
+    CHECK(tracer.size() == 2u);
+}
+
+TEST_CASE("Timer: TraceThreads", "[timer]") {
+    CLI::Tracer tracer;
+    const std::size_t spans{1000};
+    std::vector<std::thread> threads;
+    for(int t = 0; t < 4; ++t) {
+        threads.emplace_back([&tracer, spans]() {
+            for(std::size_t i = 0; i < spans; ++i) {
+                CLI::TraceSpan span{"work", tracer};
+            }
+        });
+    }
+    // reading while the threads record only sees complete events
+    std::size_t seen = tracer.size();
+    for(std::thread &thread : threads) {
+        thread.join();
+    }
+    CHECK(seen <= 4 * spans);
+    CHECK(tracer.size() == 4 * spans);
+
+    std::vector<std::uint64_t> ids;
+    tracer.for_each([&ids](std::uint64_t thread, const CLI::TraceEvent &) {
+        if(std::find(ids.begin(), ids.end(), thread) == ids.end()) {
+            ids.push_back(thread);
+        }
+    });
+    CHECK(ids.size() == 4u);
+
+    // the recorder has the signature of App::trace_phases
+    CLI::Tracer::recorder_t recorder = tracer.recorder();
+    auto now = std::chrono::steady_clock::now();
+    recorder("prog parse_args", now, now + std::chrono::microseconds(5));
+    CHECK_THAT(tracer.to_chrome_trace(), Contains("\"name\":\"prog parse_args\""));
+    CHECK_THAT(tracer.to_chrome_trace(), Contains("\"dur\":5.000"));
+}
+
+TEST_CASE("Timer: TraceAlternatingTracers", "[timer]") {
+    CLI::Tracer first;
+    CLI::Tracer second;
+    for(int i = 0; i < 100; ++i) {
+        { CLI::TraceSpan span{"first", first}; }
+        { CLI::TraceSpan span{"second\nline", second}; }
+    }
+    // a thread keeps one buffer per tracer however it switches between them
+    CHECK(first.thread_count() == 1u);
+    CHECK(second.thread_count() == 1u);
+    CHECK(first.size() == 100u);
+    CHECK(second.size() == 100u);
+    CHECK_THAT(second.to_chrome_trace(), Contains("\"name\":\"second\\nline\""));
+}
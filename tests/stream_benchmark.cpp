@@ -0,0 +1,75 @@
+// Copyright (c) 2017-2021, University of Cincinnati, developed by Henry Schreiner
+// under NSF AWARD 1414736 and by the respective contributors.
+// All rights reserved.
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Time the conversion of many custom values read through operator>> and through from_string_view; the reference
+// case builds a new std::istringstream for each value, as detail::from_stream did before reusing a stream per thread.
+
+#include "CLI/CLI.hpp"
+#include "CLI/Timer.hpp"
+
+#include <cstddef>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+/// an int read through a stream
+struct streamed {
+    int v{0};
+};
+std::istream &operator>>(std::istream &in, streamed &val) { return in >> val.v; }
+
+/// an int read by a from_string_view parser
+struct viewed {
+    int v{0};
+};
+bool from_string_view(const char *str, std::size_t length, viewed &output) {
+    return CLI::detail::lexical_cast(std::string(str, length), output.v);
+}
+
+}  // namespace bench
+
+int main(int argc, char **argv) {
+    CLI::App app{"Benchmark the conversion of custom values"};
+    std::size_t count{100000};
+    app.add_option("-n,--count", count, "Values converted per call")->capture_default_str();
+    double target{1.0};
+    app.add_option("-t,--time", target, "Seconds to measure each case")->capture_default_str();
+    CLI11_PARSE(app, argc, argv);
+
+    std::vector<std::string> values;
+    values.reserve(count);
+    for(std::size_t i = 0; i < count; ++i) {
+        values.push_back(std::to_string(i));
+    }
+    CLI::BenchmarkOptions options;
+    options.target_time = target;
+    options.min_samples = 5;
+
+    std::vector<bench::streamed> reference(count);
+    auto new_streams = [&]() {
+        for(std::size_t i = 0; i < count; ++i) {
+            std::istringstream is(values[i]);
+            is >> reference[i];
+        }
+    };
+    using streamed_t = std::vector<bench::streamed>;
+    streamed_t streamed;
+    auto reused_stream = [&]() { CLI::detail::lexical_conversion<streamed_t, streamed_t>(values, streamed); };
+    using viewed_t = std::vector<bench::viewed>;
+    viewed_t viewed;
+    auto string_view = [&]() { CLI::detail::lexical_conversion<viewed_t, viewed_t>(values, viewed); };
+
+    CLI::Timer fresh{"new stream per value"};
+    std::cout << fresh.to_string(fresh.benchmark(new_streams, options)) << std::endl;
+    CLI::Timer stream{"operator>>"};
+    std::cout << stream.to_string(stream.benchmark(reused_stream, options)) << std::endl;
+    CLI::Timer view{"from_string_view"};
+    std::cout << view.to_string(view.benchmark(string_view, options)) << std::endl;
+    return 0;
+}